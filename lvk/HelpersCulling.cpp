@@ -0,0 +1,366 @@
+/*
+ * LightweightVK
+ *
+ * Copyright (c) 2023-2026 Sergey Kosarevsky and contributors.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "HelpersCulling.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace {
+
+static const char* codeReduceCS = R"(
+layout (local_size_x = 16, local_size_y = 16, local_size_z = 1) in;
+
+layout (set = 0, binding = 0) uniform texture2D kTextures2D[];
+layout (set = 0, binding = 2, r32f) uniform image2D kTextures2DInOut[];
+
+layout(push_constant) uniform constants {
+  uvec2 srcSize;
+  uvec2 dstSize;
+  uint srcTexture;
+  uint dstTexture;
+  uint srcIsDepth; // level 0 reads the depth buffer, other levels read the previous pyramid level
+} pc;
+
+float fetchDepth(ivec2 pos) {
+  return pc.srcIsDepth != 0 ? texelFetch(kTextures2D[pc.srcTexture], pos, 0).r : imageLoad(kTextures2DInOut[pc.srcTexture], pos).r;
+}
+
+void main() {
+  uvec2 pos = gl_GlobalInvocationID.xy;
+
+  if (any(greaterThanEqual(pos, pc.dstSize)))
+    return;
+
+  // conservative: take the farthest depth of all source texels touched by this destination texel
+  vec2 scale = vec2(pc.srcSize) / vec2(pc.dstSize);
+  ivec2 p0 = ivec2(vec2(pos) * scale);
+  ivec2 p1 = min(ivec2(ceil(vec2(pos + 1) * scale)) - 1, ivec2(pc.srcSize) - 1);
+
+  float depth = 0.0;
+
+  for (int y = p0.y; y <= p1.y; y++) {
+    for (int x = p0.x; x <= p1.x; x++) {
+      depth = max(depth, fetchDepth(ivec2(x, y)));
+    }
+  }
+
+  imageStore(kTextures2DInOut[pc.dstTexture], ivec2(pos), vec4(depth));
+}
+)";
+
+static const char* codeCullCS = R"(
+layout (local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+layout (set = 0, binding = 0) uniform texture2D kTextures2D[];
+
+layout(std430, buffer_reference) readonly buffer CullingData {
+  mat4 viewProj;
+  vec4 frustumPlanes[6];
+  vec2 pyramidSize;
+  uint pyramidLevels;
+};
+
+layout(std430, buffer_reference) readonly buffer Bounds {
+  vec4 spheres[]; // xyz = center, w = radius
+};
+
+layout(std430, buffer_reference) readonly buffer DrawCommands {
+  uint words[];
+};
+
+layout(std430, buffer_reference) writeonly buffer DrawCommandsOut {
+  uint words[];
+};
+
+layout(std430, buffer_reference) buffer DrawCount {
+  uint count;
+};
+
+layout(push_constant) uniform constants {
+  CullingData data;
+  Bounds bounds;
+  DrawCommands commands;
+  DrawCommandsOut commandsOut;
+  DrawCount drawCount;
+  uint numObjects;
+  uint commandSize; // in 32-bit words
+  uint pyramid;
+  uint occlusion;
+} pc;
+
+bool isInsideFrustum(vec3 center, float radius) {
+  for (int i = 0; i != 6; i++) {
+    if (dot(pc.data.frustumPlanes[i].xyz, center) + pc.data.frustumPlanes[i].w < -radius)
+      return false;
+  }
+  return true;
+}
+
+bool isOccluded(vec3 center, float radius) {
+  vec2 minUV = vec2(1.0);
+  vec2 maxUV = vec2(0.0);
+  float minZ = 1.0;
+
+  for (int i = 0; i != 8; i++) {
+    vec3 corner = center + radius * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+    vec4 clip = pc.data.viewProj * vec4(corner, 1.0);
+    // the bounding box crosses the near plane
+    if (clip.w <= 0.0)
+      return false;
+    vec3 ndc = clip.xyz / clip.w;
+    // LVK flips the viewport: NDC y = +1 is the top row of the framebuffer (and of the depth pyramid)
+    vec2 uv = vec2(ndc.x, -ndc.y) * 0.5 + 0.5;
+    minUV = min(minUV, uv);
+    maxUV = max(maxUV, uv);
+    minZ = min(minZ, ndc.z);
+  }
+
+  minUV = clamp(minUV, vec2(0.0), vec2(1.0));
+  maxUV = clamp(maxUV, vec2(0.0), vec2(1.0));
+
+  // pick the pyramid level where the screen-space footprint covers at most 2x2 texels
+  vec2 extent = (maxUV - minUV) * pc.data.pyramidSize;
+  int lod = clamp(int(ceil(log2(max(max(extent.x, extent.y), 1.0)))), 0, int(pc.data.pyramidLevels) - 1);
+  ivec2 levelSize = textureSize(kTextures2D[pc.pyramid], lod);
+  ivec2 p0 = clamp(ivec2(minUV * vec2(levelSize)), ivec2(0), levelSize - 1);
+  ivec2 p1 = clamp(ivec2(maxUV * vec2(levelSize)), ivec2(0), levelSize - 1);
+
+  float maxZ = 0.0;
+
+  for (int y = p0.y; y <= p1.y; y++) {
+    for (int x = p0.x; x <= p1.x; x++) {
+      maxZ = max(maxZ, texelFetch(kTextures2D[pc.pyramid], ivec2(x, y), lod).r);
+    }
+  }
+
+  return minZ > maxZ;
+}
+
+void main() {
+  uint id = gl_GlobalInvocationID.x;
+
+  if (id >= pc.numObjects)
+    return;
+
+  vec4 sphere = pc.bounds.spheres[id];
+
+  if (!isInsideFrustum(sphere.xyz, sphere.w))
+    return;
+
+  if (pc.occlusion != 0 && isOccluded(sphere.xyz, sphere.w))
+    return;
+
+  uint slot = atomicAdd(pc.drawCount.count, 1);
+
+  for (uint i = 0; i != pc.commandSize; i++) {
+    pc.commandsOut.words[slot * pc.commandSize + i] = pc.commands.words[id * pc.commandSize + i];
+  }
+}
+)";
+
+// matches CullingData in codeCullCS (std430)
+struct CullingData {
+  float viewProj[16];
+  float frustumPlanes[6][4];
+  float pyramidSize[2];
+  uint32_t pyramidLevels;
+  uint32_t padding;
+};
+
+struct ReducePushConstants {
+  uint32_t srcSize[2];
+  uint32_t dstSize[2];
+  uint32_t srcTexture;
+  uint32_t dstTexture;
+  uint32_t srcIsDepth;
+};
+
+struct CullPushConstants {
+  uint64_t data;
+  uint64_t bounds;
+  uint64_t commands;
+  uint64_t commandsOut;
+  uint64_t drawCount;
+  uint32_t numObjects;
+  uint32_t commandSize;
+  uint32_t pyramid;
+  uint32_t occlusion;
+};
+
+uint32_t getPrevPowerOf2(uint32_t v) {
+  uint32_t r = 1;
+  while (r * 2 <= v) {
+    r *= 2;
+  }
+  return r;
+}
+
+// Vulkan clip space: -w <= x,y <= w and 0 <= z <= w
+void getFrustumPlanes(const float* m, float planes[6][4]) {
+  auto row = [m](int r, int i) { return m[i * 4 + r]; };
+
+  for (int i = 0; i != 4; i++) {
+    planes[0][i] = row(3, i) + row(0, i); // left
+    planes[1][i] = row(3, i) - row(0, i); // right
+    planes[2][i] = row(3, i) + row(1, i); // bottom
+    planes[3][i] = row(3, i) - row(1, i); // top
+    planes[4][i] = row(2, i); // near
+    planes[5][i] = row(3, i) - row(2, i); // far
+  }
+
+  for (int p = 0; p != 6; p++) {
+    const float len = sqrtf(planes[p][0] * planes[p][0] + planes[p][1] * planes[p][1] + planes[p][2] * planes[p][2]);
+    if (len > 0.0f) {
+      for (int i = 0; i != 4; i++) {
+        planes[p][i] /= len;
+      }
+    }
+  }
+}
+
+} // namespace
+
+namespace lvk {
+
+GPUCulling::GPUCulling(lvk::IContext& ctx) : ctx_(ctx) {
+  compReduce_ = ctx_.createShaderModule({codeReduceCS, Stage_Comp, "Shader Module: culling depth pyramid (comp)"});
+  compCull_ = ctx_.createShaderModule({codeCullCS, Stage_Comp, "Shader Module: culling (comp)"});
+  pipelineReduce_ = ctx_.createComputePipeline({.smComp = compReduce_, .debugName = "Pipeline: culling depth pyramid"});
+  pipelineCull_ = ctx_.createComputePipeline({.smComp = compCull_, .debugName = "Pipeline: culling"});
+  cullingData_ = ctx_.createBuffer({
+      .usage = lvk::BufferUsageBits_Storage,
+      .storage = lvk::StorageType_Device,
+      .size = sizeof(CullingData),
+      .debugName = "Culling: cullingData_",
+  });
+}
+
+GPUCulling::~GPUCulling() = default;
+
+void GPUCulling::createDepthPyramid(const lvk::Dimensions& dim) {
+  pyramidMips_.clear();
+
+  const uint32_t numMipLevels = lvk::calcNumMipLevels(dim.width, dim.height);
+
+  pyramid_ = ctx_.createTexture({
+      .type = lvk::TextureType_2D,
+      .format = lvk::Format_R_F32,
+      .dimensions = dim,
+      .usage = lvk::TextureUsageBits_Sampled | lvk::TextureUsageBits_Storage,
+      .numMipLevels = numMipLevels,
+      .debugName = "Culling: depth pyramid",
+  });
+
+  pyramidMips_.reserve(numMipLevels);
+
+  for (uint32_t i = 0; i != numMipLevels; i++) {
+    pyramidMips_.push_back(ctx_.createTextureView(pyramid_, {.mipLevel = i, .numMipLevels = 1}, "Culling: depth pyramid level"));
+  }
+
+  pyramidDim_ = dim;
+}
+
+void GPUCulling::cmdBuildDepthPyramid(lvk::ICommandBuffer& buffer, lvk::TextureHandle depth) {
+  LVK_PROFILER_FUNCTION();
+
+  if (!LVK_VERIFY(!depth.empty())) {
+    return;
+  }
+
+  const lvk::Dimensions depthDim = ctx_.getDimensions(depth);
+
+  // power-of-two levels make every further reduction an exact 2x2 max
+  const lvk::Dimensions dim = {
+      .width = getPrevPowerOf2(depthDim.width),
+      .height = getPrevPowerOf2(depthDim.height),
+  };
+
+  if (!pyramid_.valid() || !(pyramidDim_ == dim)) {
+    createDepthPyramid(dim);
+  }
+
+  buffer.cmdPushDebugGroupLabel("Culling: depth pyramid", 0xff00ffff);
+  buffer.cmdBindComputePipeline(pipelineReduce_);
+
+  lvk::Dimensions srcDim = depthDim;
+
+  for (uint32_t i = 0; i != pyramidMips_.size(); i++) {
+    const lvk::Dimensions dstDim = dim.divide2D(1u << i);
+    const ReducePushConstants pc = {
+        .srcSize = {srcDim.width, srcDim.height},
+        .dstSize = {dstDim.width ? dstDim.width : 1u, dstDim.height ? dstDim.height : 1u},
+        .srcTexture = i ? pyramidMips_[i - 1].index() : depth.index(),
+        .dstTexture = pyramidMips_[i].index(),
+        .srcIsDepth = i ? 0u : 1u,
+    };
+    buffer.cmdPushConstants(pc);
+    const lvk::Dimensions groups = {.width = (pc.dstSize[0] + 15) / 16, .height = (pc.dstSize[1] + 15) / 16};
+    // the whole pyramid stays in GENERAL - every dispatch gets a barrier against the previous level
+    if (i) {
+      buffer.cmdDispatch(groups, {.storageImages = {pyramid_}});
+    } else {
+      buffer.cmdDispatch(groups, {.sampledImages = {depth}, .storageImages = {pyramid_}});
+    }
+    srcDim = {.width = pc.dstSize[0], .height = pc.dstSize[1]};
+  }
+
+  buffer.cmdPopDebugGroupLabel();
+}
+
+void GPUCulling::cmdCull(lvk::ICommandBuffer& buffer, const CullingDesc& desc) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT(desc.viewProj);
+  LVK_ASSERT(desc.drawCommandSize && desc.drawCommandSize % sizeof(uint32_t) == 0);
+
+  buffer.cmdFillBuffer(desc.drawCount, 0, sizeof(uint32_t), 0);
+
+  if (!desc.numObjects) {
+    return;
+  }
+
+  const bool occlusion = desc.occlusion && pyramid_.valid();
+
+  CullingData data = {
+      .pyramidSize = {(float)pyramidDim_.width, (float)pyramidDim_.height},
+      .pyramidLevels = (uint32_t)pyramidMips_.size(),
+  };
+  memcpy(data.viewProj, desc.viewProj, sizeof(data.viewProj));
+  getFrustumPlanes(desc.viewProj, data.frustumPlanes);
+
+  buffer.cmdPushDebugGroupLabel("Culling", 0xff00ffff);
+  buffer.cmdUpdateBuffer(cullingData_, data);
+  buffer.cmdBindComputePipeline(pipelineCull_);
+
+  const CullPushConstants pc = {
+      .data = ctx_.gpuAddress(cullingData_),
+      .bounds = ctx_.gpuAddress(desc.bounds),
+      .commands = ctx_.gpuAddress(desc.drawCommands),
+      .commandsOut = ctx_.gpuAddress(desc.drawCommandsOut),
+      .drawCount = ctx_.gpuAddress(desc.drawCount),
+      .numObjects = desc.numObjects,
+      .commandSize = desc.drawCommandSize / (uint32_t)sizeof(uint32_t),
+      .pyramid = occlusion ? pyramid_.index() : 0u,
+      .occlusion = occlusion ? 1u : 0u,
+  };
+  buffer.cmdPushConstants(pc);
+
+  const lvk::Dimensions groups = {.width = (desc.numObjects + 63) / 64};
+
+  if (occlusion) {
+    buffer.cmdDispatch(groups, {.sampledImages = {pyramid_}, .buffers = {cullingData_, desc.drawCount}});
+  } else {
+    buffer.cmdDispatch(groups, {.buffers = {cullingData_, desc.drawCount}});
+  }
+
+  buffer.cmdPopDebugGroupLabel();
+}
+
+} // namespace lvk
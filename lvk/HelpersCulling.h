@@ -0,0 +1,72 @@
+/*
+ * LightweightVK
+ *
+ * Copyright (c) 2023-2026 Sergey Kosarevsky and contributors.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <lvk/LVK.h>
+
+#include <vector>
+
+namespace lvk {
+
+// world-space bounding sphere of one object
+struct CullingBounds {
+  float center[3] = {};
+  float radius = 0.0f;
+};
+
+struct CullingDesc {
+  // column-major 4x4 matrix used for rendering: Vulkan clip space (depth 0..1) with LVK's flipped viewport, i.e. NDC y = +1 is the top row
+  const float* viewProj = nullptr;
+  BufferHandle bounds; // CullingBounds[numObjects]
+  BufferHandle drawCommands; // one indirect command per object
+  BufferHandle drawCommandsOut; // visible commands, compacted (BufferUsageBits_Indirect | BufferUsageBits_Storage)
+  BufferHandle drawCount; // uint32_t number of visible commands (BufferUsageBits_Indirect | BufferUsageBits_Storage)
+  uint32_t numObjects = 0;
+  // 20 = VkDrawIndexedIndirectCommand, 12 = VkDrawMeshTasksIndirectCommandEXT
+  uint32_t drawCommandSize = 20;
+  bool occlusion = true; // test against the depth pyramid built by cmdBuildDepthPyramid()
+};
+
+/*
+ * Compute-based frustum and Hi-Z occlusion culling. It writes the visible draw commands into a compacted indirect buffer
+ * plus a count, ready for cmdDrawIndexedIndirectCount() or cmdDrawMeshTasksIndirectCount(). Commands are copied verbatim,
+ * so shaders should identify objects via baseInstance (or a similar field) rather than gl_DrawID.
+ * Pass `drawCommandsOut` and `drawCount` to Dependencies::buffers of the render pass consuming them.
+ */
+class GPUCulling {
+ public:
+  explicit GPUCulling(lvk::IContext& ctx);
+  ~GPUCulling();
+
+  // Build a max-depth pyramid from a depth buffer rendered earlier (e.g. the previous frame or a depth pre-pass).
+  // Standard depth range is expected: 0 is near, 1 is far.
+  void cmdBuildDepthPyramid(lvk::ICommandBuffer& buffer, lvk::TextureHandle depth);
+  void cmdCull(lvk::ICommandBuffer& buffer, const CullingDesc& desc);
+
+  [[nodiscard]] lvk::TextureHandle getDepthPyramid() const {
+    return pyramid_;
+  }
+
+ private:
+  void createDepthPyramid(const lvk::Dimensions& dim);
+
+ private:
+  lvk::IContext& ctx_;
+  lvk::Holder<lvk::ShaderModuleHandle> compReduce_;
+  lvk::Holder<lvk::ShaderModuleHandle> compCull_;
+  lvk::Holder<lvk::ComputePipelineHandle> pipelineReduce_;
+  lvk::Holder<lvk::ComputePipelineHandle> pipelineCull_;
+  lvk::Holder<lvk::BufferHandle> cullingData_;
+  lvk::Holder<lvk::TextureHandle> pyramid_;
+  std::vector<lvk::Holder<lvk::TextureHandle>> pyramidMips_; // one single-mip view per level, used as storage images
+  lvk::Dimensions pyramidDim_ = {0, 0, 0};
+};
+
+} // namespace lvk
@@ -389,11 +389,39 @@ void ImGuiRenderer::endFrame(lvk::ICommandBuffer& cmdBuffer) {
   cmdBuffer.cmdBindIndexBuffer(drawableData.ib_, lvk::IndexFormat_UI16);
   cmdBuffer.cmdBindRenderPipeline(pipeline_);
 
+  struct VulkanImguiBindData {
+    float LRTB[4]; // ortho projection: left, right, top, bottom
+    uint64_t vb = 0;
+    uint32_t textureId = 0;
+    uint32_t samplerId = 0;
+  };
+
+  // consecutive draw commands sharing the same texture and clip rectangle go into one multi-draw call
+  uint32_t batchTextureId = 0;
+  lvk::ScissorRect batchScissor = {};
+
+  auto flushDraws = [&]() {
+    if (draws_.empty()) {
+      return;
+    }
+    const VulkanImguiBindData bindData = {
+        .LRTB = {L, R, T, B},
+        .vb = ctx_.gpuAddress(drawableData.vb_),
+        .textureId = batchTextureId,
+        .samplerId = samplerClamp_.index(),
+    };
+    cmdBuffer.cmdPushConstants(bindData);
+    cmdBuffer.cmdBindScissorRect(batchScissor);
+    cmdBuffer.cmdDrawMultiIndexed(draws_);
+    draws_.clear();
+  };
+
   for (const ImDrawList* cmdList : dd->CmdLists) {
     for (int cmd_i = 0; cmd_i < cmdList->CmdBuffer.Size; cmd_i++) {
       const ImDrawCmd cmd = cmdList->CmdBuffer[cmd_i];
 
       if (cmd.UserCallback) {
+        flushDraws();
         if (cmd.UserCallback == ImDrawCallback_ResetRenderState) {
           cmdBuffer.cmdBindViewport({.x = 0.0f, .y = 0.0f, .width = fb_width, .height = fb_height});
           cmdBuffer.cmdBindIndexBuffer(drawableData.ib_, lvk::IndexFormat_UI16);
@@ -414,26 +442,26 @@ void ImGuiRenderer::endFrame(lvk::ICommandBuffer& cmdBuffer) {
       if (clipMax.x <= clipMin.x || clipMax.y <= clipMin.y)
          continue;
       // clang-format on
-      struct VulkanImguiBindData {
-        float LRTB[4]; // ortho projection: left, right, top, bottom
-        uint64_t vb = 0;
-        uint32_t textureId = 0;
-        uint32_t samplerId = 0;
-      } bindData = {
-          .LRTB = {L, R, T, B},
-          .vb = ctx_.gpuAddress(drawableData.vb_),
-          .textureId = static_cast<uint32_t>(cmd.GetTexID()),
-          .samplerId = samplerClamp_.index(),
-      };
-      cmdBuffer.cmdPushConstants(bindData);
-      cmdBuffer.cmdBindScissorRect(
-          {uint32_t(clipMin.x), uint32_t(clipMin.y), uint32_t(clipMax.x - clipMin.x), uint32_t(clipMax.y - clipMin.y)});
-      cmdBuffer.cmdDrawIndexed(cmd.ElemCount, 1u, idxOffset + cmd.IdxOffset, int32_t(vtxOffset + cmd.VtxOffset));
+      const uint32_t textureId = static_cast<uint32_t>(cmd.GetTexID());
+      const lvk::ScissorRect scissor = {
+          uint32_t(clipMin.x), uint32_t(clipMin.y), uint32_t(clipMax.x - clipMin.x), uint32_t(clipMax.y - clipMin.y)};
+      if (textureId != batchTextureId || memcmp(&scissor, &batchScissor, sizeof(scissor))) {
+        flushDraws();
+        batchTextureId = textureId;
+        batchScissor = scissor;
+      }
+      draws_.push_back({
+          .firstIndex = idxOffset + cmd.IdxOffset,
+          .indexCount = cmd.ElemCount,
+          .vertexOffset = int32_t(vtxOffset + cmd.VtxOffset),
+      });
     }
     idxOffset += cmdList->IdxBuffer.Size;
     vtxOffset += cmdList->VtxBuffer.Size;
   }
 
+  flushDraws();
+
   cmdBuffer.cmdPopDebugGroupLabel();
 }
 
@@ -16,6 +16,8 @@
 #include <imgui.h>
 #include <lvk/LVK.h>
 
+#include <vector>
+
 namespace lvk {
 
 class ImGuiRenderer {
@@ -56,6 +58,8 @@ class ImGuiRenderer {
   };
 
   DrawableData drawables_[3] = {};
+
+  std::vector<lvk::DrawIndexedRange> draws_; // reused by endFrame() to batch draw commands
 };
 
 } // namespace lvk
@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -93,6 +94,7 @@
   #define LVK_PROFILER_ZONE_END() }
   #define LVK_PROFILER_THREAD(name) tracy::SetThreadName(name)
   #define LVK_PROFILER_FRAME(name) FrameMarkNamed(name)
+  #define LVK_PROFILER_PLOT(name, value) TracyPlot(name, value)
 #else
   #define LVK_PROFILER_FUNCTION()
   #define LVK_PROFILER_FUNCTION_COLOR(color)
@@ -100,6 +102,7 @@
   #define LVK_PROFILER_ZONE_END() }
   #define LVK_PROFILER_THREAD(name)
   #define LVK_PROFILER_FRAME(name)
+  #define LVK_PROFILER_PLOT(name, value)
 #endif // LVK_WITH_TRACY
 // clang-format on
 
@@ -121,6 +124,7 @@ using BufferHandle = ldr::Handle<struct Buffer>;
 using TextureHandle = ldr::Handle<struct Texture>;
 using QueryPoolHandle = ldr::Handle<struct QueryPool>;
 using AccelStructHandle = ldr::Handle<struct AccelerationStructure>;
+using CommandListHandle = ldr::Handle<struct CommandList>;
 
 // forward declarations to access incomplete type IContext
 void destroy(lvk::IContext* ctx, lvk::ComputePipelineHandle handle);
@@ -132,6 +136,7 @@ void destroy(lvk::IContext* ctx, lvk::BufferHandle handle);
 void destroy(lvk::IContext* ctx, lvk::TextureHandle handle);
 void destroy(lvk::IContext* ctx, lvk::QueryPoolHandle handle);
 void destroy(lvk::IContext* ctx, lvk::AccelStructHandle handle);
+void destroy(lvk::IContext* ctx, lvk::CommandListHandle handle);
 
 template<typename HandleType>
 class Holder final {
@@ -344,6 +349,19 @@ struct Dimensions {
   }
 };
 
+// matches the layout of VkMultiDrawInfoEXT
+struct DrawRange {
+  uint32_t firstVertex = 0;
+  uint32_t vertexCount = 0;
+};
+
+// matches the layout of VkMultiDrawIndexedInfoEXT
+struct DrawIndexedRange {
+  uint32_t firstIndex = 0;
+  uint32_t indexCount = 0;
+  int32_t vertexOffset = 0;
+};
+
 struct Viewport {
   float x = 0.0f;
   float y = 0.0f;
@@ -744,6 +762,10 @@ struct RenderPipelineDesc final {
   float minSampleShading = 0.0f;
   bool alphaToCoverage = false;
 
+  // Bound instead of this pipeline while it is being compiled in the background (ContextConfig::numPipelineCompileThreads).
+  // It should be compatible with the same render pass. Without a fallback, draws are skipped until this pipeline is ready
+  RenderPipelineHandle fallbackPipeline;
+
   const char* debugName = "";
 
   uint32_t getNumColorAttachments() const {
@@ -796,6 +818,8 @@ struct RenderPass final {
 
   uint32_t layerCount = 1;
   uint32_t viewMask = 0;
+  // the contents are recorded on worker threads (see IContext::acquireSecondaryCommandBuffer()) or replayed from command lists
+  bool useSecondaryCommandBuffers = false;
 
   uint32_t getNumColorAttachments() const {
     uint32_t n = 0;
@@ -899,6 +923,16 @@ struct ComponentMapping {
   }
 };
 
+// mapped staging memory which any thread can fill, see IContext::reserveStaging()
+struct StagingReservation {
+  void* data = nullptr;
+  size_t size = 0;
+  uint32_t id = 0;
+  bool empty() const {
+    return data == nullptr;
+  }
+};
+
 struct TextureDesc {
   TextureType type = TextureType_2D;
   Format format = Format_Invalid;
@@ -911,8 +945,9 @@ struct TextureDesc {
   StorageType storage = StorageType_Device;
   ComponentMapping components = {};
   const void* data = nullptr;
+  StagingReservation dataStaging = {}; // an alternative to `data`: the same contents already written into reserved staging memory
   uint32_t dataNumMipLevels = 1; // how many mip-levels we want to upload
-  bool generateMipmaps = false; // generate mip-levels immediately, valid only with non-null data
+  bool generateMipmaps = false; // generate mip-levels immediately, valid only with non-null data (or dataStaging)
   const char* debugName = "";
 };
 
@@ -1024,6 +1059,49 @@ struct SubmitHandle {
 
 static_assert(sizeof(SubmitHandle) == sizeof(uint64_t));
 
+// cumulative counters since the context was created, see IContext::getStagingStats()
+struct StagingStats {
+  uint64_t bytesStaged = 0; // copied through the staging buffer (host image copies are not included)
+  uint64_t numChunks = 0; // staged copies submitted to the GPU
+  uint32_t numForcedWaits = 0; // CPU stalls waiting for the GPU to free staging memory
+  double forcedWaitTimeMs = 0;
+  uint64_t stagingBufferSize = 0;
+  uint64_t peakStagingBufferSize = 0;
+  uint32_t numReallocations = 0; // the staging buffer grew (up to ContextConfig::maxStagingBufferSize)
+};
+
+// cumulative counters since the context was created, see IContext::getCommandBufferStats()
+struct CommandBufferStats {
+  uint32_t numCommandBuffers = 0; // allocated for all queues (the pools grow on demand)
+  uint32_t peakNumInFlight = 0; // the most command buffers of one queue being recorded or executed at the same time
+  uint32_t numGrowths = 0; // a queue ran out of free command buffers and allocated a new one
+  uint32_t numStalls = 0; // CPU stalls waiting for the GPU to retire a command buffer (a pool reached its maximal size)
+  double stallTimeMs = 0;
+  // dynamic state, vertex/index buffer bindings and push constants in submitted command buffers
+  uint64_t numStateCommandsEmitted = 0;
+  uint64_t numStateCommandsSkipped = 0; // identical to the state already set in that command buffer
+};
+
+// see IContext::getDescriptorSetStats()
+struct DescriptorSetStats {
+  uint32_t numDescriptorSets = 0; // bindless descriptor sets in the ring (see ContextConfig::maxDescriptorSets)
+  uint64_t numDescriptors = 0; // allocated for all of them, each descriptor takes a few dozen bytes of pool memory
+  uint64_t descriptorBufferSize = 0; // bytes, ContextConfig::enableDescriptorBuffer only
+  uint32_t numLayoutChanges = 0; // the bindless layout was recreated and every pipeline had to be rebuilt
+  uint32_t numStalls = 0; // CPU stalls waiting for the GPU to release the oldest descriptor set
+  double stallTimeMs = 0;
+};
+
+// a pending asynchronous readback, see IContext::downloadAsync()
+struct ReadbackTicket {
+  SubmitHandle handle = {}; // the submit which copies the data into the readback ring
+  uint32_t id = 0;
+  size_t size = 0;
+  bool empty() const {
+    return handle.empty();
+  }
+};
+
 struct Dependencies {
   ldr::Span<TextureHandle> sampledImages = {};
   ldr::Span<TextureHandle> storageImages = {};
@@ -1057,6 +1135,10 @@ class ICommandBuffer {
   virtual void cmdBeginRendering(const lvk::RenderPass& renderPass, const lvk::Framebuffer& desc, const Dependencies& deps = {}) = 0;
   virtual void cmdEndRendering() = 0;
   virtual void cmdNextSubpass() = 0;
+  // executes secondary command buffers (in this order) inside a render pass started with RenderPass::useSecondaryCommandBuffers
+  virtual void cmdExecuteCommands(const ldr::Span<ICommandBuffer*>& secondaryCommandBuffers) = 0;
+  // replays a command list (re-recording it first if it became stale) inside a render pass with RenderPass::useSecondaryCommandBuffers
+  virtual void cmdExecuteCommandList(CommandListHandle commandList) = 0;
 
   virtual void cmdBindViewport(const Viewport& viewport) = 0;
   virtual void cmdBindScissorRect(const ScissorRect& rect) = 0;
@@ -1092,6 +1174,9 @@ class ICommandBuffer {
                               uint32_t firstIndex = 0,
                               int32_t vertexOffset = 0,
                               uint32_t baseInstance = 0) = 0;
+  // VK_EXT_multi_draw when available, otherwise one draw call per range
+  virtual void cmdDrawMulti(const ldr::Span<DrawRange>& draws, uint32_t instanceCount = 1, uint32_t baseInstance = 0) = 0;
+  virtual void cmdDrawMultiIndexed(const ldr::Span<DrawIndexedRange>& draws, uint32_t instanceCount = 1, uint32_t baseInstance = 0) = 0;
   virtual void cmdDrawIndirect(BufferHandle indirectBuffer, size_t indirectBufferOffset, uint32_t drawCount, uint32_t stride = 0) = 0;
   virtual void cmdDrawIndexedIndirect(BufferHandle indirectBuffer,
                                       size_t indirectBufferOffset,
@@ -1156,6 +1241,14 @@ class IContext {
                               TextureHandle present = {},
                               const ldr::Span<TextureHandle>& release = {}) = 0; // hand these images to the other queue (destination
                                                                                  // implied by the CB's queue); the acquire is automatic
+
+  // Submits several command buffers of the same queue (executed in this order) in one vkQueueSubmit2() with a single timeline signal.
+  // `present` is transitioned at the end of the last one. Writes the SubmitHandle of every command buffer into `outHandles` (optional, one
+  // per command buffer) and returns the handle of the last one. Command buffers submitted separately should be submitted in the order they
+  // were acquired: resources destroyed while several command buffers are being recorded are released with the most recently acquired one.
+  virtual SubmitHandle submit(const ldr::Span<ICommandBuffer*>& commandBuffers,
+                              TextureHandle present = {},
+                              SubmitHandle* outHandles = nullptr) = 0;
   virtual void wait(SubmitHandle handle) = 0; // waiting on an empty handle results in vkDeviceWaitIdle()
 
   [[nodiscard]] virtual Holder<BufferHandle> createBuffer(const BufferDesc& desc,
@@ -1191,6 +1284,7 @@ class IContext {
   virtual void destroy(TextureHandle handle) = 0;
   virtual void destroy(QueryPoolHandle handle) = 0;
   virtual void destroy(AccelStructHandle handle) = 0;
+  virtual void destroy(CommandListHandle handle) = 0;
   virtual void destroy(Framebuffer& fb) = 0;
 
   [[nodiscard]] virtual uint64_t gpuAddress(AccelStructHandle handle) const = 0;
@@ -1199,6 +1293,14 @@ class IContext {
   [[nodiscard]] virtual AccelStructSizes getAccelStructSizes(const AccelStructDesc& desc, Result* outResult = nullptr) const = 0;
 #pragma endregion
 
+#pragma region Pipeline functions
+  // false while the pipeline variant for `viewMask` is being compiled in the background; starts the compilation if needed
+  [[nodiscard]] virtual bool isPipelineReady(RenderPipelineHandle handle, uint32_t viewMask = 0) = 0;
+  // Builds the variants of `pipelines` for all `viewMasks` (empty - just 0) and waits for them, e.g. behind a loading screen.
+  // Variants for different view masks stay resident side by side (up to 4 per pipeline)
+  virtual void warmupPipelines(const ldr::Span<RenderPipelineHandle>& pipelines, const ldr::Span<uint32_t>& viewMasks = {}) = 0;
+#pragma endregion
+
 #pragma region Buffer functions
   virtual Result upload(BufferHandle handle, const void* data, size_t size, size_t offset = 0) = 0;
   virtual Result download(BufferHandle handle, void* data, size_t size, size_t offset) = 0;
@@ -1217,6 +1319,63 @@ class IContext {
   [[nodiscard]] virtual Format getFormat(TextureHandle handle) const = 0;
 #pragma endregion
 
+#pragma region Asynchronous readback
+  // Copies the data into a persistent host-visible readback ring and returns immediately. Poll getReadbackData() a few frames later: it
+  // returns nullptr while the copy is in flight. The data stays valid until releaseReadback(), which has to be called for every ticket.
+  [[nodiscard]] virtual ReadbackTicket downloadAsync(BufferHandle handle, size_t size, size_t offset = 0, Result* outResult = nullptr) = 0;
+  [[nodiscard]] virtual ReadbackTicket downloadAsync(TextureHandle handle, const TextureRangeDesc& range, Result* outResult = nullptr) = 0;
+  [[nodiscard]] virtual const void* getReadbackData(const ReadbackTicket& ticket) = 0;
+  virtual void releaseReadback(const ReadbackTicket& ticket) = 0;
+#pragma endregion
+
+#pragma region Staging reservations
+  // Thread-safe: reserves mapped staging memory which any thread can fill directly (e.g. decode an image into it). The render thread then
+  // consumes it via upload() or TextureDesc::dataStaging, which only records the GPU copy. Every reservation has to be either uploaded once
+  // or cancelled. Never stalls: returns an empty reservation if the ring is full (see ContextConfig::stagingReservationRingSize).
+  [[nodiscard]] virtual StagingReservation reserveStaging(size_t size, Result* outResult = nullptr) = 0;
+  virtual void cancelStaging(const StagingReservation& reservation) = 0;
+  virtual Result upload(BufferHandle handle, const StagingReservation& reservation, size_t offset = 0) = 0;
+  // 2D and cube textures only, the reservation is laid out as `data` in upload() above
+  virtual Result upload(TextureHandle handle, const TextureRangeDesc& range, const StagingReservation& reservation) = 0;
+#pragma endregion
+
+#pragma region File uploads
+  // Reads `size` bytes at `fileOffset` of the file straight into the mapped staging memory, without an intermediate copy in system memory.
+  // Buffers larger than the staging buffer are streamed in multiple chunks.
+  virtual Result uploadFromFile(BufferHandle handle, const char* fileName, size_t fileOffset, size_t size, size_t offset = 0) = 0;
+  // 2D and cube textures only, the file contains mip-levels and layers laid out as `data` in upload()
+  virtual Result uploadFromFile(TextureHandle handle, const TextureRangeDesc& range, const char* fileName, size_t fileOffset = 0) = 0;
+#pragma endregion
+
+#pragma region Upload batches
+  // All staged uploads between beginUploadBatch() and endUploadBatch() are recorded into a single command buffer (it is flushed early only
+  // if the staging buffer fills up). The uploaded data is visible to command buffers submitted after the batch, and submit() flushes
+  // an open batch automatically. Returns an empty handle if nothing was recorded.
+  virtual void beginUploadBatch() = 0;
+  virtual SubmitHandle endUploadBatch() = 0;
+#pragma endregion
+
+#pragma region Multi-threaded recording
+  // Secondary command buffers let worker threads record the contents of one render pass in parallel. Every `threadIndex` (less than
+  // ContextConfig::maxRecordingThreads) has its own command pool, so use one index per thread. `renderPass` and `fb` must match the
+  // cmdBeginRendering() of the primary command buffer. Call endSecondaryCommandBuffer() on the recording thread, then execute it from the
+  // primary via cmdExecuteCommands(); it is recycled once that submission completes. Do not create or destroy resources, and do not submit
+  // anything, while worker threads are recording. The first use of a render pipeline compiles it under a context-wide lock: with the
+  // default ContextConfig::numPipelineCompileThreads = 0 this serializes all recording threads, so call warmupPipelines() beforehand.
+  virtual ICommandBuffer& acquireSecondaryCommandBuffer(uint32_t threadIndex, const RenderPass& renderPass, const Framebuffer& fb) = 0;
+  virtual void endSecondaryCommandBuffer(ICommandBuffer& commandBuffer) = 0;
+#pragma endregion
+
+#pragma region Command lists
+  // A command list captures the commands of a static pass once and replays them via ICommandBuffer::cmdExecuteCommandList(). `record` is
+  // invoked on the render thread by the first execution, and again whenever the recorded commands went stale: one of its render pipelines
+  // was re-created, the bindless descriptor set was rebuilt (e.g. new textures), or the attachment formats or size of the render pass
+  // changed. Everything `record` references has to outlive the command list. Do not create resources from `record`.
+  [[nodiscard]] virtual Holder<CommandListHandle> createCommandList(std::function<void(ICommandBuffer& cmdBuffer)> record,
+                                                                    const char* debugName = nullptr,
+                                                                    Result* outResult = nullptr) = 0;
+#pragma endregion
+
   virtual TextureHandle getCurrentSwapchainTexture() = 0;
   virtual Format getSwapchainFormat() const = 0;
   virtual ColorSpace getSwapchainColorSpace() const = 0;
@@ -1234,6 +1393,11 @@ class IContext {
 
 #pragma region Performance queries
   virtual double getTimestampPeriodToMs() const = 0;
+  // with LVK_WITH_TRACY, these are also plotted on every presented frame
+  [[nodiscard]] virtual StagingStats getStagingStats() const = 0;
+  // accumulated over the graphics, async-compute and transfer queues
+  [[nodiscard]] virtual CommandBufferStats getCommandBufferStats() const = 0;
+  [[nodiscard]] virtual DescriptorSetStats getDescriptorSetStats() const = 0;
   virtual bool getQueryPoolResults(QueryPoolHandle pool,
                                    uint32_t firstQuery,
                                    uint32_t queryCount,
@@ -1275,6 +1439,12 @@ struct ContextConfig {
   // owned by the application - should be alive until createVulkanContextWithSwapchain() returns
   const void* pipelineCacheData = nullptr;
   size_t pipelineCacheDataSize = 0;
+  // Built-in persistent pipeline cache: <pipelineCacheDirectory>/<vendorID>_<deviceID>/<driverVersion>_<pipelineCacheUUID>.bin is
+  // loaded at startup (instead of `pipelineCacheData`) and saved at shutdown. When new pipelines were created, it is also saved on
+  // presentation at most once per `pipelineCacheSavePeriodMs`, off the presenting thread (written by a pipeline compilation thread if
+  // there are any, otherwise by a short-lived std::async() task). Blobs of other driver versions are deleted
+  const char* pipelineCacheDirectory = nullptr;
+  uint32_t pipelineCacheSavePeriodMs = 5000;
   // Define preferred present modes, the first available present mode will  be used. PresentMode_FIFO is always available
   lvk::PresentMode presentModes[kMaxPresentModes] = {
 #if defined(__linux__) || defined(_M_ARM64)
@@ -1295,8 +1465,27 @@ struct ContextConfig {
   // VK_KHR_fragment_shading_rate is mutually exclusive with VK_EXT_fragment_density_map. When the device supports FSR, requesting it here
   // disables FDM (otherwise fragment density map is enabled as usual)
   bool enableFragmentShadingRate = false;
+  // VK_EXT_descriptor_buffer: keep bindless descriptors in a host-visible buffer instead of descriptor sets. Creating textures and
+  // samplers then writes their descriptors straight into the buffer. Falls back to descriptor sets when unsupported
+  bool enableDescriptorBuffer = false;
+  // VK_EXT_graphics_pipeline_library: render pipelines are fast-linked from separately cached vertex input, pre-rasterization,
+  // fragment shader and fragment output libraries. With `numPipelineCompileThreads` an optimized link replaces them in the background.
+  // Falls back to monolithic pipelines when unsupported (or when the driver cannot link fast)
+  bool enableGraphicsPipelineLibrary = false;
 
   uint64_t maxStagingBufferSize = 128ull * 1024ull * 1024ull; // a reasonable default
+  uint64_t readbackRingSize = 32ull * 1024ull * 1024ull; // IContext::downloadAsync(); larger readbacks get a dedicated buffer
+  uint64_t stagingReservationRingSize = 0; // IContext::reserveStaging(); allocated up front, 0 disables staging reservations
+  uint32_t maxRecordingThreads = 16; // IContext::acquireSecondaryCommandBuffer(); command pools are created on first use
+  // Bindless arrays are sized for at least this many textures/samplers up front. Growing past the reservation recreates the descriptor
+  // set layout, which rebuilds every pipeline on its next use
+  uint32_t reservedBindlessTextures = 1024;
+  uint32_t reservedBindlessSamplers = 128;
+  // bindless descriptor sets are recycled once the GPU is done with them; the CPU waits when all of them are in flight
+  uint32_t maxDescriptorSets = 4;
+  // Render pipelines are compiled on these threads starting at createRenderPipeline(), and binding one which is not ready yet
+  // does not block (see IContext::isPipelineReady()). 0 - compile lazily on the first bind, blocking the recording thread
+  uint32_t numPipelineCompileThreads = 0;
 };
 
 [[nodiscard]] bool isDepthOrStencilFormat(lvk::Format format);
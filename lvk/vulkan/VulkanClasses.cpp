@@ -7,7 +7,13 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
+#include <filesystem>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #define VMA_IMPLEMENTATION
@@ -26,6 +32,8 @@
 
 #ifndef VK_USE_PLATFORM_WIN32_KHR
 #include <unistd.h>
+#else
+#include <process.h>
 #endif
 
 // clang-format off
@@ -41,7 +49,7 @@
 #include <malloc.h>
 #endif
 
-uint32_t lvk::VulkanPipelineBuilder::numPipelinesCreated_ = 0;
+std::atomic<uint32_t> lvk::VulkanPipelineBuilder::numPipelinesCreated_ = 0;
 
 static_assert(lvk::HWDeviceDesc::LVK_MAX_PHYSICAL_DEVICE_NAME_SIZE == VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
 static_assert(lvk::Swizzle_Default == (uint32_t)VK_COMPONENT_SWIZZLE_IDENTITY);
@@ -87,6 +95,137 @@ VkDeviceSize getAlignedSize(uint64_t value, uint64_t alignment) {
   return (value + alignment - 1) & ~(alignment - 1);
 }
 
+// the same usage flags have to be passed to vkCmdBindDescriptorBuffersEXT()
+VkBufferUsageFlags getDescriptorBufferUsageFlags(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& props) {
+  return VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+         VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+         (props.bufferlessPushDescriptors ? 0u : VK_BUFFER_USAGE_PUSH_DESCRIPTORS_DESCRIPTOR_BUFFER_BIT_EXT);
+}
+
+// the storage size for all mip-levels being uploaded (starting from a `width` x `height` mip-level), see VulkanStagingDevice::imageData2D()
+uint64_t getImageStorageSize2D(uint32_t width, uint32_t height, lvk::Format format, uint32_t numMipLevels, uint32_t numLayers) {
+  uint32_t layerStorageSize = 0;
+  for (uint32_t i = 0; i < numMipLevels; ++i) {
+    layerStorageSize += lvk::getTextureBytesPerLayer(width, height, format, i);
+  }
+  return (uint64_t)layerStorageSize * numLayers;
+}
+
+// 64-bit file offsets on all platforms (off_t is 32-bit on 32-bit Android and Linux)
+int seekFile64(FILE* file, int64_t offset, int origin) {
+#if defined(_WIN32)
+  return _fseeki64(file, (__int64)offset, origin);
+#elif defined(__APPLE__)
+  return fseeko(file, (off_t)offset, origin);
+#else
+  return fseeko64(file, (off64_t)offset, origin);
+#endif // _WIN32
+}
+
+int64_t tellFile64(FILE* file) {
+#if defined(_WIN32)
+  return _ftelli64(file);
+#elif defined(__APPLE__)
+  return ftello(file);
+#else
+  return ftello64(file);
+#endif // _WIN32
+}
+
+uint32_t getCurrentProcessId() {
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+  return (uint32_t)_getpid();
+#else
+  return (uint32_t)getpid();
+#endif // VK_USE_PLATFORM_WIN32_KHR
+}
+
+// opens a binary file with at least `size` bytes after `offset` and seeks to `offset`; returns nullptr on failure. The size is checked
+// up front, so a short file fails before any chunk of the upload is recorded
+FILE* openFileAt(const char* fileName, uint64_t offset, uint64_t size) {
+  FILE* file = fopen(fileName, "rb");
+
+  if (!file) {
+    return nullptr;
+  }
+
+  const int64_t fileSize = seekFile64(file, 0, SEEK_END) == 0 ? tellFile64(file) : -1;
+
+  if (fileSize < 0 || (uint64_t)fileSize < offset + size || seekFile64(file, (int64_t)offset, SEEK_SET) != 0) {
+    fclose(file);
+    return nullptr;
+  }
+
+  return file;
+}
+
+// checks the VkPipelineCacheHeaderVersionOne of a pipeline cache blob against the physical device
+bool isPipelineCacheCompatible(const void* data, size_t size, const VkPhysicalDeviceProperties& props) {
+  VkPipelineCacheHeaderVersionOne header = {};
+
+  if (!data || size < sizeof(header)) {
+    return false;
+  }
+
+  // the blob can be unaligned
+  memcpy(&header, data, sizeof(header));
+
+  return header.headerSize >= sizeof(header) && header.headerSize <= size &&
+         header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header.vendorID == props.vendorID &&
+         header.deviceID == props.deviceID && memcmp(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+// FNV-1a, used to find identical pipeline descriptions. With `key`, all hashed bytes are collected there too, so that equal hashes
+// can be confirmed by comparing the keys
+class Hasher final {
+ public:
+  explicit Hasher(std::vector<uint8_t>* key = nullptr) : key_(key) {}
+  void bytes(const void* data, size_t size) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i != size; i++) {
+      hash_ = (hash_ ^ p[i]) * 1099511628211ull;
+    }
+    if (key_) {
+      key_->insert(key_->end(), p, p + size);
+    }
+  }
+  template<typename T>
+  void value(T v) {
+    bytes(&v, sizeof(v));
+  }
+  void string(const char* str) {
+    str ? bytes(str, strlen(str) + 1) : value(0u);
+  }
+  void specInfo(const lvk::SpecializationConstantDesc& desc) {
+    const uint32_t numEntries = desc.getNumSpecializationConstants();
+    value(numEntries);
+    for (uint32_t i = 0; i != numEntries; i++) {
+      value(desc.entries[i].constantId);
+      value(desc.entries[i].offset);
+      value(desc.entries[i].size);
+    }
+    value(desc.data ? desc.dataSize : 0);
+    if (desc.data) {
+      bytes(desc.data, desc.dataSize);
+    }
+  }
+  uint64_t get() const {
+    return hash_;
+  }
+
+ private:
+  uint64_t hash_ = 14695981039346656037ull;
+  std::vector<uint8_t>* key_ = nullptr;
+};
+
+// VK_EXT_graphics_pipeline_library: graphics pipelines are linked out of these parts, each one is cached separately
+const VkGraphicsPipelineLibraryFlagBitsEXT kPipelineLibraryParts[] = {
+    VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+    VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+    VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+    VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+};
+
 uint64_t getAlignedAddress(uint64_t addr, uint64_t align) {
   const uint64_t offs = addr % align;
   return offs ? addr + (align - offs) : addr;
@@ -804,15 +943,79 @@ struct DeferredTask {
   SubmitHandle handle_;
 };
 
+// everything vkCreateGraphicsPipelines() reads from, so the pipeline can be built on a pipeline compilation thread
+struct RenderPipelineCompileJob final {
+  VulkanPipelineBuilder builder;
+  // copies, the shader modules pool can be reallocated in the meantime (the SPIR-V code itself is not copied)
+  VkShaderModuleCreateInfo shaderModules[Stage_Mesh + 1] = {};
+  VkSpecializationMapEntry entries[SpecializationConstantDesc::LVK_SPECIALIZATION_CONSTANTS_MAX] = {};
+  VkSpecializationInfo si = {};
+  std::vector<uint8_t> specData;
+  VkVertexInputBindingDescription vkBindings[VertexInput::LVK_VERTEX_BUFFER_MAX] = {};
+  VkVertexInputAttributeDescription vkAttributes[VertexInput::LVK_VERTEX_ATTRIBUTES_MAX] = {};
+  VkPipelineLayout layout = VK_NULL_HANDLE;
+  const char* debugName = nullptr;
+
+  // VK_EXT_graphics_pipeline_library: hashes of the parts in `kPipelineLibraryParts` (0 if a part is not needed), all 0 for monolithic
+  uint64_t libraryHashes[LVK_ARRAY_NUM_ELEMENTS(kPipelineLibraryParts)] = {};
+  std::vector<uint8_t> libraryKeys[LVK_ARRAY_NUM_ELEMENTS(kPipelineLibraryParts)]; // what `libraryHashes` were computed from
+  uint32_t numLibraries = 0;
+  VkPipeline libraries[LVK_ARRAY_NUM_ELEMENTS(kPipelineLibraryParts)] = {}; // non-owning, from VulkanContextImpl::pipelineLibraries_
+  bool isOptimizedLink = false; // links `libraries` with link-time optimizations to replace a fast-linked pipeline
+  RenderPipelineCompileJob* optimizedLinkJob = nullptr; // queued by a fast link, then owned by the pipeline variant
+
+  VkPipeline pipeline = VK_NULL_HANDLE;
+  std::packaged_task<void()> task;
+  std::future<void> done;
+
+  bool isReady() const {
+    return done.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }
+};
+
 struct VulkanContextImpl final {
   // Vulkan Memory Allocator
   VmaAllocator vma_ = VK_NULL_HANDLE;
 
-  lvk::CommandBuffer currentCommandBuffer_;
-  lvk::CommandBuffer currentComputeCommandBuffer_; // async-compute slot (coexists with the graphics one).
+  // indexed by SubmitHandle::bufferIndex_ of the acquired command buffer wrappers (so several command buffers can be recorded at once);
+  // these grow together with the command buffer pools of VulkanImmediateCommands
+  std::deque<lvk::CommandBuffer> commandBuffers_;
+  std::deque<lvk::CommandBuffer> computeCommandBuffers_; // async-compute slots
 
   std::vector<DeferredTask> deferredTasks_;
 
+  // secondary command buffers bind render pipelines on worker threads, and getVkPipeline() creates the VkPipeline objects lazily
+  std::mutex renderPipelinesMutex_;
+
+  // ContextConfig::numPipelineCompileThreads
+  std::vector<std::thread> pipelineCompileThreads_;
+  std::mutex pipelineCompileMutex_;
+  std::condition_variable pipelineCompileCondition_;
+  std::deque<RenderPipelineCompileJob*> pipelineCompileQueue_; // not picked up by any thread yet
+  bool pipelineCompileExit_ = false;
+  // the periodic pipeline cache write, taken by the next free compilation thread (guarded by `pipelineCompileMutex_`); without
+  // compilation threads, it runs via std::async()
+  std::packaged_task<void()> pipelineCacheSaveTask_;
+  std::future<void> pipelineCacheSaveDone_; // render thread only
+
+  // identical pipelines grouped by their hashes, the owner of the shared Vulkan objects goes first
+  std::unordered_map<uint64_t, std::vector<RenderPipelineHandle>> renderPipelineGroups_; // guarded by `renderPipelinesMutex_`
+  std::unordered_map<uint64_t, std::vector<ComputePipelineHandle>> computePipelineGroups_;
+
+  // VK_EXT_graphics_pipeline_library: shared by all render pipelines, destroyed together with the context
+  struct PipelineLibrary {
+    VkGraphicsPipelineLibraryFlagsEXT part = 0;
+    std::vector<uint8_t> key; // RenderPipelineCompileJob::libraryKeys, to tell hash collisions apart
+    VkPipeline pipeline = VK_NULL_HANDLE;
+  };
+  std::mutex pipelineLibrariesMutex_;
+  std::unordered_map<uint64_t, PipelineLibrary> pipelineLibraries_;
+
+  // ContextConfig::pipelineCacheDirectory
+  std::string pipelineCacheFileName_;
+  uint32_t pipelineCacheNumPipelinesSaved_ = 0;
+  std::chrono::steady_clock::time_point pipelineCacheSaveTime_ = {};
+
   struct YcbcrConversionData {
     VkSamplerYcbcrConversionInfo info;
     lvk::Holder<SamplerHandle> sampler;
@@ -910,6 +1113,25 @@ void lvk::VulkanBuffer::bufferSubData(const VulkanContext& ctx, size_t offset, s
   }
 }
 
+bool lvk::VulkanBuffer::bufferSubData(const VulkanContext& ctx, size_t offset, size_t size, FILE* file) {
+  // only host-visible buffers can be uploaded this way
+  LVK_ASSERT(mappedPtr_);
+
+  if (!mappedPtr_ || !file) {
+    return false;
+  }
+
+  LVK_ASSERT(offset + size <= bufferSize_);
+
+  const size_t numBytesRead = fread((uint8_t*)mappedPtr_ + offset, 1, size, file);
+
+  if (!isCoherentMemory_) {
+    flushMappedMemory(ctx, offset, size);
+  }
+
+  return numBytesRead == size;
+}
+
 VkImageView lvk::VulkanImage::createImageView(VkDevice device,
                                               VkImageViewType type,
                                               VkFormat format,
@@ -1426,6 +1648,7 @@ lvk::VulkanSwapchain::VulkanSwapchain(VulkanContext& ctx, uint32_t width, uint32
                                              debugNameImageView);
 
     swapchainTextures_[i] = ctx_.texturesPool_.create(std::move(image));
+    ctx_.dirtyTextures_.push_back(swapchainTextures_[i].index());
   }
 }
 
@@ -1591,26 +1814,10 @@ lvk::VulkanImmediateCommands::VulkanImmediateCommands(VkDevice device,
   VK_ASSERT(vkCreateCommandPool(device, &ci, nullptr, &commandPool_));
   VK_ASSERT(lvk::setDebugObjectName(device, VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)commandPool_, debugName));
 
-  const VkCommandBufferAllocateInfo ai = {
-      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-      .commandPool = commandPool_,
-      .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-      .commandBufferCount = 1,
-  };
+  freeBuffers_.reserve(kNumInitialCommandBuffers);
 
-  for (uint32_t i = 0; i != kMaxCommandBuffers; i++) {
-    CommandBufferWrapper& buf = buffers_[i];
-    char fenceName[256] = {0};
-    char semaphoreName[256] = {0};
-    if (debugName) {
-      (void)snprintf(fenceName, sizeof(fenceName) - 1, "Fence: %s (cmdbuf %u)", debugName, i);
-      (void)snprintf(semaphoreName, sizeof(semaphoreName) - 1, "Semaphore: %s (cmdbuf %u)", debugName, i);
-    }
-    buf.semaphore_ = lvk::createSemaphore(device, semaphoreName);
-    buf.fence_ = lvk::createFence(device, fenceName);
-    VK_ASSERT(vkAllocateCommandBuffers(device, &ai, &buf.cmdBufAllocated_));
-    buffers_[i].handle_.bufferIndex_ = i;
-    buffers_[i].handle_.queueFamilyIndex_ = queueFamilyIndex; // make every SubmitHandle self-describing
+  for (uint32_t i = 0; i != kNumInitialCommandBuffers; i++) {
+    createCommandBuffer();
   }
 
   char timelineName[256] = {0};
@@ -1626,8 +1833,6 @@ lvk::VulkanImmediateCommands::~VulkanImmediateCommands() {
   waitAll();
 
   for (CommandBufferWrapper& buf : buffers_) {
-    // lifetimes of all VkFence objects are managed explicitly we do not use deferredTask() for them
-    vkDestroyFence(device_, buf.fence_, nullptr);
     vkDestroySemaphore(device_, buf.semaphore_, nullptr);
   }
 
@@ -1635,63 +1840,121 @@ lvk::VulkanImmediateCommands::~VulkanImmediateCommands() {
   vkDestroyCommandPool(device_, commandPool_, nullptr);
 }
 
+void lvk::VulkanImmediateCommands::createCommandBuffer() {
+  LVK_PROFILER_FUNCTION_COLOR(LVK_PROFILER_COLOR_CREATE);
+
+  const uint32_t index = static_cast<uint32_t>(buffers_.size());
+
+  LVK_ASSERT(index < kMaxCommandBuffers);
+
+  CommandBufferWrapper& buf = buffers_.emplace_back();
+
+  char semaphoreName[256] = {0};
+  if (debugName_) {
+    (void)snprintf(semaphoreName, sizeof(semaphoreName) - 1, "Semaphore: %s (cmdbuf %u)", debugName_, index);
+  }
+
+  const VkCommandBufferAllocateInfo ai = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+      .commandPool = commandPool_,
+      .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+      .commandBufferCount = 1,
+  };
+  buf.semaphore_ = lvk::createSemaphore(device_, semaphoreName);
+  VK_ASSERT(vkAllocateCommandBuffers(device_, &ai, &buf.cmdBufAllocated_));
+  buf.handle_.bufferIndex_ = index;
+  buf.handle_.queueFamilyIndex_ = queueFamilyIndex_; // make every SubmitHandle self-describing
+
+  freeBuffers_.push_back(index);
+
+  stats_.numCommandBuffers++;
+}
+
 void lvk::VulkanImmediateCommands::purge() {
   LVK_PROFILER_FUNCTION();
 
-  const uint32_t numBuffers = static_cast<uint32_t>(LVK_ARRAY_NUM_ELEMENTS(buffers_));
-
-  for (uint32_t i = 0; i != numBuffers; i++) {
-    // always start checking with the oldest submitted buffer, then wrap around
-    CommandBufferWrapper& buf = buffers_[(i + lastSubmitHandle_.bufferIndex_ + 1) % numBuffers];
+  if (submittedBuffers_.empty()) {
+    return;
+  }
 
-    if (buf.cmdBuf_ == VK_NULL_HANDLE || buf.isEncoding_) {
-      continue;
-    }
+  const uint64_t completedValue = updateCompletedTimelineValue();
 
-    const VkResult result = vkWaitForFences(device_, 1, &buf.fence_, VK_TRUE, 0);
+  // timeline values grow in submission order: retire the oldest submitted buffers until we hit the first one still in flight
+  while (!submittedBuffers_.empty()) {
+    const uint32_t index = submittedBuffers_.front();
+    CommandBufferWrapper& buf = buffers_[index];
 
-    if (result == VK_SUCCESS) {
-      VK_ASSERT(vkResetCommandBuffer(buf.cmdBuf_, VkCommandBufferResetFlags{0}));
-      VK_ASSERT(vkResetFences(device_, 1, &buf.fence_));
-      buf.cmdBuf_ = VK_NULL_HANDLE;
-      numAvailableCommandBuffers_++;
-    } else {
-      if (result != VK_TIMEOUT) {
-        VK_ASSERT(result);
-      }
+    if (buf.signaledTimelineValue_ > completedValue) {
+      break;
     }
+
+    VK_ASSERT(vkResetCommandBuffer(buf.cmdBuf_, VkCommandBufferResetFlags{0}));
+    buf.cmdBuf_ = VK_NULL_HANDLE;
+    freeBuffers_.push_back(index);
+    submittedBuffers_.pop_front();
   }
 }
 
+uint64_t lvk::VulkanImmediateCommands::updateCompletedTimelineValue() const {
+  uint64_t value = 0;
+  VK_ASSERT(vkGetSemaphoreCounterValue(device_, submitTimelineSemaphore_, &value));
+
+  // racing loader threads may store an older value, which only makes the cache less fresh
+  completedTimelineValue_.store(value, std::memory_order_relaxed);
+
+  return value;
+}
+
+bool lvk::VulkanImmediateCommands::isComplete(const CommandBufferWrapper& buf) const {
+  // `signaledTimelineValue_` of a buffer being recorded belongs to its previous submission
+  return !buf.isEncoding_ && buf.signaledTimelineValue_ <= completedTimelineValue_.load(std::memory_order_relaxed);
+}
+
+void lvk::VulkanImmediateCommands::waitUntilComplete(const CommandBufferWrapper& buf) const {
+  const VkSemaphoreWaitInfo waitInfo = {
+      .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+      .semaphoreCount = 1,
+      .pSemaphores = &submitTimelineSemaphore_,
+      .pValues = &buf.signaledTimelineValue_,
+  };
+  VK_ASSERT(vkWaitSemaphores(device_, &waitInfo, UINT64_MAX));
+
+  updateCompletedTimelineValue();
+}
+
 const lvk::VulkanImmediateCommands::CommandBufferWrapper& lvk::VulkanImmediateCommands::acquire() {
   LVK_PROFILER_FUNCTION();
 
-  if (!numAvailableCommandBuffers_) {
+  if (freeBuffers_.empty()) {
     purge();
   }
 
-  while (!numAvailableCommandBuffers_) {
-    LLOGL("Waiting for command buffers...\n");
-    LVK_PROFILER_ZONE("Waiting for command buffers...", LVK_PROFILER_COLOR_WAIT);
-    purge();
-    LVK_PROFILER_ZONE_END();
+  if (freeBuffers_.empty()) {
+    if (buffers_.size() < kMaxCommandBuffers) {
+      // everything is still in flight: grow the pool instead of stalling
+      createCommandBuffer();
+      stats_.numGrowths++;
+    } else {
+      LVK_ASSERT_MSG(!submittedBuffers_.empty(), "All command buffers are being recorded and none can be recycled");
+      LLOGL("Waiting for command buffers...\n");
+      LVK_PROFILER_ZONE("Waiting for command buffers...", LVK_PROFILER_COLOR_WAIT);
+      const auto startTime = std::chrono::steady_clock::now();
+      waitUntilComplete(buffers_[submittedBuffers_.front()]);
+      purge();
+      stats_.numStalls++;
+      stats_.stallTimeMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+      LVK_PROFILER_ZONE_END();
+    }
   }
 
-  VulkanImmediateCommands::CommandBufferWrapper* current = nullptr;
+  LVK_ASSERT_MSG(!freeBuffers_.empty(), "No available command buffers");
 
-  // we are ok with any available buffer
-  for (CommandBufferWrapper& buf : buffers_) {
-    if (buf.cmdBuf_ == VK_NULL_HANDLE) {
-      current = &buf;
-      break;
-    }
-  }
+  CommandBufferWrapper* current = &buffers_[freeBuffers_.back()];
+  freeBuffers_.pop_back();
 
-  // make clang happy
-  assert(current);
+  stats_.peakNumInFlight = std::max(stats_.peakNumInFlight, static_cast<uint32_t>(buffers_.size() - freeBuffers_.size()));
 
-  LVK_ASSERT_MSG(numAvailableCommandBuffers_, "No available command buffers");
-  LVK_ASSERT_MSG(current, "No available command buffers");
+  LVK_ASSERT(current->cmdBuf_ == VK_NULL_HANDLE);
   LVK_ASSERT(current->cmdBufAllocated_ != VK_NULL_HANDLE);
 
   // wait for a pending present still using this slot's semaphore before reusing it (VUID-vkQueueSubmit2-semaphore-03868)
@@ -1702,7 +1965,6 @@ const lvk::VulkanImmediateCommands::CommandBufferWrapper& lvk::VulkanImmediateCo
   }
 
   current->handle_.submitId_ = submitCounter_;
-  numAvailableCommandBuffers_--;
 
   current->cmdBuf_ = current->cmdBufAllocated_;
   current->isEncoding_ = true;
@@ -1734,7 +1996,7 @@ void lvk::VulkanImmediateCommands::wait(const SubmitHandle handle) {
     return;
   }
 
-  VK_ASSERT(vkWaitForFences(device_, 1, &buffers_[handle.bufferIndex_].fence_, VK_TRUE, UINT64_MAX));
+  waitUntilComplete(buffers_[handle.bufferIndex_]);
 
   purge();
 }
@@ -1742,25 +2004,18 @@ void lvk::VulkanImmediateCommands::wait(const SubmitHandle handle) {
 void lvk::VulkanImmediateCommands::waitAll() {
   LVK_PROFILER_FUNCTION_COLOR(LVK_PROFILER_COLOR_WAIT);
 
-  VkFence fences[kMaxCommandBuffers];
-
-  uint32_t numFences = 0;
-
-  for (const CommandBufferWrapper& buf : buffers_) {
-    if (buf.cmdBuf_ != VK_NULL_HANDLE && !buf.isEncoding_) {
-      fences[numFences++] = buf.fence_;
-    }
+  if (submittedBuffers_.empty()) {
+    return;
   }
 
-  if (numFences) {
-    VK_ASSERT(vkWaitForFences(device_, numFences, fences, VK_TRUE, UINT64_MAX));
-  }
+  // the most recent submit signals the highest timeline value
+  waitUntilComplete(buffers_[submittedBuffers_.back()]);
 
   purge();
 }
 
 bool lvk::VulkanImmediateCommands::isReady(const SubmitHandle handle, bool fastCheckNoVulkan) const {
-  LVK_ASSERT(handle.bufferIndex_ < kMaxCommandBuffers);
+  LVK_ASSERT(handle.bufferIndex_ < buffers_.size());
 
   if (handle.empty()) {
     // a null handle
@@ -1779,18 +2034,44 @@ bool lvk::VulkanImmediateCommands::isReady(const SubmitHandle handle, bool fastC
     return true;
   }
 
-  if (fastCheckNoVulkan) {
-    // do not ask the Vulkan API about it, just let it retire naturally (when submitId for this bufferIndex gets incremented)
+  if (isComplete(buf)) {
+    // the cached timeline value is enough, no need to ask the Vulkan API
+    return true;
+  }
+
+  if (fastCheckNoVulkan || buf.isEncoding_) {
+    // do not ask the Vulkan API about it, just let it retire naturally (when the cached timeline value gets updated)
     return false;
   }
 
-  return vkWaitForFences(device_, 1, &buf.fence_, VK_TRUE, 0) == VK_SUCCESS;
+  updateCompletedTimelineValue();
+
+  return isComplete(buf);
 }
 
 lvk::SubmitHandle lvk::VulkanImmediateCommands::submit(const CommandBufferWrapper& wrapper) {
+  const CommandBufferWrapper* wrappers[] = {&wrapper};
+
+  return submit(wrappers, 1u);
+}
+
+lvk::SubmitHandle lvk::VulkanImmediateCommands::submit(const CommandBufferWrapper* const* wrappers, uint32_t numWrappers) {
   LVK_PROFILER_FUNCTION_COLOR(LVK_PROFILER_COLOR_SUBMIT);
-  LVK_ASSERT(wrapper.isEncoding_);
-  VK_ASSERT(vkEndCommandBuffer(wrapper.cmdBuf_));
+  LVK_ASSERT(numWrappers && numWrappers <= kMaxBatchedCommandBuffers);
+
+  VkCommandBufferSubmitInfo bufferSIs[kMaxBatchedCommandBuffers];
+
+  for (uint32_t i = 0; i != numWrappers; i++) {
+    LVK_ASSERT(wrappers[i]->isEncoding_);
+    VK_ASSERT(vkEndCommandBuffer(wrappers[i]->cmdBuf_));
+    bufferSIs[i] = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+        .commandBuffer = wrappers[i]->cmdBuf_,
+    };
+  }
+
+  // the last command buffer owns the binary semaphore of this submission
+  const CommandBufferWrapper& wrapper = *wrappers[numWrappers - 1];
 
   // waits: swapchain-acquire + intra-queue chain + an optional cross-queue timeline wait (e.g. Dependencies::waitCompute)
   VkSemaphoreSubmitInfo waitSemaphores[3];
@@ -1823,26 +2104,24 @@ lvk::SubmitHandle lvk::VulkanImmediateCommands::submit(const CommandBufferWrappe
   if (signalSemaphore_.semaphore) {
     signalSemaphores[numSignalSemaphores++] = signalSemaphore_;
   }
-  wrapper.signaledTimelineValue_ = timelineValue;
+  for (uint32_t i = 0; i != numWrappers; i++) {
+    wrappers[i]->signaledTimelineValue_ = timelineValue;
+  }
 
   LVK_PROFILER_ZONE("vkQueueSubmit2()", LVK_PROFILER_COLOR_SUBMIT);
 #if LVK_VULKAN_PRINT_COMMANDS
-  LLOGL("%p vkQueueSubmit2()\n\n", wrapper.cmdBuf_);
+  LLOGL("%p vkQueueSubmit2() with %u command buffer(s)\n\n", wrapper.cmdBuf_, numWrappers);
 #endif // LVK_VULKAN_PRINT_COMMANDS
-  const VkCommandBufferSubmitInfo bufferSI = {
-      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
-      .commandBuffer = wrapper.cmdBuf_,
-  };
   const VkSubmitInfo2 si = {
       .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
       .waitSemaphoreInfoCount = numWaitSemaphores,
       .pWaitSemaphoreInfos = waitSemaphores,
-      .commandBufferInfoCount = 1u,
-      .pCommandBufferInfos = &bufferSI,
+      .commandBufferInfoCount = numWrappers,
+      .pCommandBufferInfos = bufferSIs,
       .signalSemaphoreInfoCount = numSignalSemaphores,
       .pSignalSemaphoreInfos = signalSemaphores,
   };
-  const VkResult result = vkQueueSubmit2(queue_, 1u, &si, wrapper.fence_);
+  const VkResult result = vkQueueSubmit2(queue_, 1u, &si, VK_NULL_HANDLE);
   if (has_EXT_device_fault_ && result == VK_ERROR_DEVICE_LOST) {
     VkDeviceFaultCountsEXT count = {
         .sType = VK_STRUCTURE_TYPE_DEVICE_FAULT_COUNTS_EXT,
@@ -1921,7 +2200,10 @@ lvk::SubmitHandle lvk::VulkanImmediateCommands::submit(const CommandBufferWrappe
   signalSemaphore_.semaphore = VK_NULL_HANDLE;
 
   // reset
-  wrapper.isEncoding_ = false;
+  for (uint32_t i = 0; i != numWrappers; i++) {
+    wrappers[i]->isEncoding_ = false;
+    submittedBuffers_.push_back(wrappers[i]->handle_.bufferIndex_);
+  }
   submitCounter_++;
 
   if (!submitCounter_) {
@@ -1961,14 +2243,6 @@ void lvk::VulkanImmediateCommands::setLastPresentSemaphore(VkSemaphore semaphore
   lastPresentFence_ = presentFence;
 }
 
-VkFence lvk::VulkanImmediateCommands::getVkFence(lvk::SubmitHandle handle) const {
-  if (handle.empty()) {
-    return VK_NULL_HANDLE;
-  }
-
-  return buffers_[handle.bufferIndex_].fence_;
-}
-
 uint64_t lvk::VulkanImmediateCommands::getTimelineValue(lvk::SubmitHandle handle) const {
   if (handle.empty()) {
     return 0;
@@ -2212,6 +2486,59 @@ VkResult lvk::VulkanPipelineBuilder::build(VkDevice device,
                                            VkPipelineLayout pipelineLayout,
                                            VkPipeline* outPipeline,
                                            const char* debugName) noexcept {
+  return createPipeline(device, pipelineCache, pipelineLayout, 0, outPipeline, debugName);
+}
+
+VkResult lvk::VulkanPipelineBuilder::buildLibrary(VkDevice device,
+                                                  VkPipelineCache pipelineCache,
+                                                  VkPipelineLayout pipelineLayout,
+                                                  VkGraphicsPipelineLibraryFlagsEXT libraryFlags,
+                                                  VkPipeline* outPipeline,
+                                                  const char* debugName) noexcept {
+  LVK_ASSERT(libraryFlags);
+  return createPipeline(device, pipelineCache, pipelineLayout, libraryFlags, outPipeline, debugName);
+}
+
+VkResult lvk::VulkanPipelineBuilder::link(VkDevice device,
+                                          VkPipelineCache pipelineCache,
+                                          VkPipelineLayout pipelineLayout,
+                                          const VkPipeline* libraries,
+                                          uint32_t numLibraries,
+                                          bool optimize,
+                                          VkPipeline* outPipeline,
+                                          const char* debugName) noexcept {
+  const VkPipelineLibraryCreateInfoKHR libraryInfo = {
+      .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+      .libraryCount = numLibraries,
+      .pLibraries = libraries,
+  };
+  // all the state comes from the libraries
+  const VkGraphicsPipelineCreateInfo ci = {
+      .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+      .pNext = &libraryInfo,
+      .flags = flags_ | (optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0u),
+      .layout = pipelineLayout,
+      .basePipelineHandle = VK_NULL_HANDLE,
+      .basePipelineIndex = -1,
+  };
+
+  const VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &ci, nullptr, outPipeline);
+
+  if (!LVK_VERIFY(result == VK_SUCCESS)) {
+    return result;
+  }
+
+  numPipelinesCreated_++;
+
+  return lvk::setDebugObjectName(device, VK_OBJECT_TYPE_PIPELINE, (uint64_t)*outPipeline, debugName);
+}
+
+VkResult lvk::VulkanPipelineBuilder::createPipeline(VkDevice device,
+                                                    VkPipelineCache pipelineCache,
+                                                    VkPipelineLayout pipelineLayout,
+                                                    VkGraphicsPipelineLibraryFlagsEXT libraryFlags,
+                                                    VkPipeline* outPipeline,
+                                                    const char* debugName) noexcept {
   const VkPipelineDynamicStateCreateInfo dynamicState = {
       .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
       .dynamicStateCount = numDynamicStates_,
@@ -2242,13 +2569,34 @@ VkResult lvk::VulkanPipelineBuilder::build(VkDevice device,
       .depthAttachmentFormat = depthAttachmentFormat_,
       .stencilAttachmentFormat = stencilAttachmentFormat_,
   };
+  const VkGraphicsPipelineLibraryCreateInfoEXT libraryInfo = {
+      .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+      .pNext = &renderingInfo,
+      .flags = libraryFlags,
+  };
+
+  // libraries take only the shader stages of their part (state of other parts is ignored)
+  uint32_t numStages = 0;
+  VkPipelineShaderStageCreateInfo stages[LVK_ARRAY_NUM_ELEMENTS(shaderStages_)] = {};
+  for (uint32_t i = 0; i != numShaderStages_; i++) {
+    const VkGraphicsPipelineLibraryFlagsEXT part = shaderStages_[i].stage == VK_SHADER_STAGE_FRAGMENT_BIT
+                                                       ? VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT
+                                                       : VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+    if (!libraryFlags || (libraryFlags & part)) {
+      stages[numStages++] = shaderStages_[i];
+    }
+  }
+
+  // libraries keep the link-time optimization info around, so they can be linked again into an optimized pipeline later
+  const VkPipelineCreateFlags libraryCreateFlags =
+      libraryFlags ? VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT : 0u;
 
   const VkGraphicsPipelineCreateInfo ci = {
       .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-      .pNext = &renderingInfo,
-      .flags = flags_,
-      .stageCount = numShaderStages_,
-      .pStages = shaderStages_,
+      .pNext = libraryFlags ? (const void*)&libraryInfo : &renderingInfo,
+      .flags = flags_ | libraryCreateFlags,
+      .stageCount = numStages,
+      .pStages = numStages ? stages : nullptr,
       .pVertexInputState = &vertexInputState_,
       .pInputAssemblyState = &inputAssembly_,
       .pTessellationState = &tessellationState_,
@@ -2286,10 +2634,33 @@ lvk::CommandBuffer::CommandBuffer(VulkanContext* ctx, VulkanImmediateCommands& i
 , immediate_(&immediate)
 , queueFamilyIndex_(queueFamilyIndex) {}
 
+lvk::CommandBuffer::CommandBuffer(VulkanContext* ctx,
+                                  const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                                  const Framebuffer& fb,
+                                  uint32_t viewMask,
+                                  uint32_t threadIndex)
+: ctx_(ctx)
+, wrapper_(&wrapper)
+, immediate_(ctx->immediate_.get())
+, queueFamilyIndex_(ctx->deviceQueues_.graphicsQueueFamilyIndex)
+, framebuffer_(fb)
+, viewMask_(viewMask)
+, isSecondary_(true)
+, secondaryThreadIndex_(threadIndex) {}
+
 bool lvk::CommandBuffer::isComputeOnlyQueue() const {
   return ctx_->immediateCompute_ && immediate_ == ctx_->immediateCompute_.get();
 }
 
+bool lvk::CommandBuffer::skipRedundantState(bool isRedundant) {
+  if (isRedundant) {
+    numStateCommandsSkipped_++;
+  } else {
+    numStateCommandsEmitted_++;
+  }
+  return isRedundant;
+}
+
 lvk::CommandBuffer::~CommandBuffer() {
   // did you forget to call cmdEndRendering()?
   LVK_ASSERT(!isRendering_);
@@ -2458,6 +2829,9 @@ void lvk::CommandBuffer::cmdBindRayTracingPipeline(lvk::RayTracingPipelineHandle
   LVK_ASSERT(rtps);
   LVK_ASSERT(pipeline != VK_NULL_HANDLE);
 
+  lastPipelineLayout_ = rtps->pipelineLayout_;
+  lastPushConstantsStageFlags_ = rtps->shaderStageFlags_;
+
   if (lastPipelineBound_ != pipeline) {
     lastPipelineBound_ = pipeline;
     vkCmdBindPipeline(wrapper_->cmdBuf_, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, pipeline);
@@ -2481,9 +2855,17 @@ void lvk::CommandBuffer::cmdBindComputePipeline(lvk::ComputePipelineHandle handl
 
   const lvk::ComputePipelineState* cps = ctx_->computePipelinesPool_.get(handle);
 
+  // identical pipelines share the Vulkan objects of their owner
+  if (cps && cps->owner_.valid()) {
+    cps = ctx_->computePipelinesPool_.get(cps->owner_);
+  }
+
   LVK_ASSERT(cps);
   LVK_ASSERT(pipeline != VK_NULL_HANDLE);
 
+  lastPipelineLayout_ = cps->pipelineLayout_;
+  lastPushConstantsStageFlags_ = VK_SHADER_STAGE_COMPUTE_BIT;
+
   if (lastPipelineBound_ != pipeline) {
     lastPipelineBound_ = pipeline;
     vkCmdBindPipeline(wrapper_->cmdBuf_, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
@@ -2654,9 +3036,12 @@ void lvk::CommandBuffer::cmdBeginRendering(const lvk::RenderPass& renderPass, co
   LVK_PROFILER_FUNCTION();
 
   LVK_ASSERT(!isRendering_);
+  LVK_ASSERT_MSG(!isSecondary_, "Secondary command buffers are recorded inside the render pass of the primary command buffer");
 
   isRendering_ = true;
   viewMask_ = renderPass.viewMask;
+  hasSecondaryContents_ = renderPass.useSecondaryCommandBuffers;
+  renderPass_ = renderPass;
 
   addCrossQueueDependencies(deps);
   cmdTransitionToShaderReadOnly(deps.sampledImages, {});
@@ -2901,7 +3286,7 @@ void lvk::CommandBuffer::cmdBeginRendering(const lvk::RenderPass& renderPass, co
   const VkRenderingInfo renderingInfo = {
       .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
       .pNext = fb.fragmentDensityMap ? (const void*)&fragmentDensityMapInfo : (fb.shadingRateAttachment ? &shadingRateInfo : nullptr),
-      .flags = 0,
+      .flags = renderPass.useSecondaryCommandBuffers ? (VkRenderingFlags)VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0u,
       .renderArea = {VkOffset2D{(int32_t)scissor.x, (int32_t)scissor.y}, VkExtent2D{scissor.width, scissor.height}},
       .layerCount = renderPass.layerCount,
       .viewMask = renderPass.viewMask,
@@ -2915,6 +3300,7 @@ void lvk::CommandBuffer::cmdBeginRendering(const lvk::RenderPass& renderPass, co
   cmdBindScissorRect(scissor);
   cmdBindDepthState({});
 
+  // flush pending descriptor updates on the render thread: secondary command buffers of this render pass only read the descriptor sets
   ctx_->checkAndUpdateDescriptorSets();
 
   vkCmdSetDepthCompareOp(wrapper_->cmdBuf_, VK_COMPARE_OP_ALWAYS);
@@ -2927,6 +3313,7 @@ void lvk::CommandBuffer::cmdEndRendering() {
   LVK_ASSERT(isRendering_);
 
   isRendering_ = false;
+  hasSecondaryContents_ = false;
 
   vkCmdEndRendering(wrapper_->cmdBuf_);
 
@@ -2954,6 +3341,67 @@ void lvk::CommandBuffer::cmdNextSubpass() {
   vkCmdPipelineBarrier2(wrapper_->cmdBuf_, &dependencyInfo);
 }
 
+void lvk::CommandBuffer::cmdExecuteCommands(const ldr::Span<ICommandBuffer*>& secondaryCommandBuffers) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT(!isSecondary_);
+  LVK_ASSERT_MSG(isRendering_ && hasSecondaryContents_,
+                 "Secondary command buffers can be executed only inside a render pass with RenderPass::useSecondaryCommandBuffers");
+
+  if (secondaryCommandBuffers.empty()) {
+    return;
+  }
+
+  std::vector<VkCommandBuffer> cmdBufs;
+  cmdBufs.reserve(secondaryCommandBuffers.size());
+
+  for (ICommandBuffer* buffer : secondaryCommandBuffers) {
+    const lvk::CommandBuffer* secondary = static_cast<const lvk::CommandBuffer*>(buffer);
+    LVK_ASSERT(secondary && secondary->isSecondary_);
+    LVK_ASSERT_MSG(!secondary->wrapper_->isEncoding_, "Call IContext::endSecondaryCommandBuffer() before executing it");
+    cmdBufs.push_back(secondary->wrapper_->cmdBuf_);
+    executedSecondaries_.push_back(secondary);
+  }
+
+  vkCmdExecuteCommands(wrapper_->cmdBuf_, (uint32_t)cmdBufs.size(), cmdBufs.data());
+
+  for (ICommandBuffer* buffer : secondaryCommandBuffers) {
+    const lvk::CommandBuffer* secondary = static_cast<const lvk::CommandBuffer*>(buffer);
+    numStateCommandsEmitted_ += secondary->numStateCommandsEmitted_;
+    numStateCommandsSkipped_ += secondary->numStateCommandsSkipped_;
+  }
+
+  // the primary command buffer state is undefined after vkCmdExecuteCommands()
+  lastPipelineBound_ = VK_NULL_HANDLE;
+  stateCache_ = {};
+}
+
+void lvk::CommandBuffer::cmdExecuteCommandList(CommandListHandle commandList) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT(!isSecondary_);
+  LVK_ASSERT_MSG(isRendering_ && hasSecondaryContents_,
+                 "Command lists can be executed only inside a render pass with RenderPass::useSecondaryCommandBuffers");
+
+  CommandListState* list = ctx_->commandListsPool_.get(commandList);
+
+  if (!LVK_VERIFY(list)) {
+    return;
+  }
+
+  // put newly created resources into the descriptor set before checking whether the recorded commands are stale
+  ctx_->checkAndUpdateDescriptorSets();
+
+  if (!ctx_->secondaryCommands_->isValid(*list, renderPass_, framebuffer_)) {
+    ctx_->secondaryCommands_->record(*list, renderPass_, framebuffer_);
+  }
+
+  vkCmdExecuteCommands(wrapper_->cmdBuf_, 1, &list->wrapper_.cmdBuf_);
+
+  lastPipelineBound_ = VK_NULL_HANDLE;
+  stateCache_ = {};
+}
+
 void lvk::CommandBuffer::cmdBindViewport(const Viewport& viewport) {
   // https://www.saschawillems.de/blog/2019/03/29/flipping-the-vulkan-viewport/
   const VkViewport vp = {
@@ -2964,6 +3412,14 @@ void lvk::CommandBuffer::cmdBindViewport(const Viewport& viewport) {
       .minDepth = viewport.minDepth, // float minDepth;
       .maxDepth = viewport.maxDepth, // float maxDepth;
   };
+
+  if (skipRedundantState(stateCache_.hasViewport && !memcmp(&stateCache_.viewport, &vp, sizeof(vp)))) {
+    return;
+  }
+
+  stateCache_.hasViewport = true;
+  stateCache_.viewport = vp;
+
   vkCmdSetViewport(wrapper_->cmdBuf_, 0, 1, &vp);
 }
 
@@ -2972,6 +3428,14 @@ void lvk::CommandBuffer::cmdBindScissorRect(const ScissorRect& rect) {
       VkOffset2D{(int32_t)rect.x, (int32_t)rect.y},
       VkExtent2D{rect.width, rect.height},
   };
+
+  if (skipRedundantState(stateCache_.hasScissor && !memcmp(&stateCache_.scissor, &scissor, sizeof(scissor)))) {
+    return;
+  }
+
+  stateCache_.hasScissor = true;
+  stateCache_.scissor = scissor;
+
   vkCmdSetScissor(wrapper_->cmdBuf_, 0, 1, &scissor);
 }
 
@@ -2996,18 +3460,49 @@ void lvk::CommandBuffer::cmdBindRenderPipeline(lvk::RenderPipelineHandle handle)
     LLOGW("Make sure your render pass and render pipeline both have matching depth attachments");
   }
 
-  VkPipeline pipeline = ctx_->getVkPipeline(handle, viewMask_);
+  VkPipeline pipeline = ctx_->getVkPipeline(handle, viewMask_, false);
 
-  LVK_ASSERT(pipeline != VK_NULL_HANDLE);
+  // identical pipelines share the Vulkan objects of their owner
+  const lvk::RenderPipelineState* owner = rps->owner_.valid() ? ctx_->renderPipelinesPool_.get(rps->owner_) : rps;
+
+  // the layout exists before the compilation starts, so push constants issued while draws are skipped still have a valid layout
+  lastPipelineLayout_ = owner->pipelineLayout_;
+  lastPushConstantsStageFlags_ = owner->shaderStageFlags_;
+
+  if (pipeline == VK_NULL_HANDLE) {
+    // still being compiled in the background; command lists recorded now are re-recorded once it is ready
+    if (commandList_) {
+      commandList_->pipelines_.emplace_back(handle, VK_NULL_HANDLE);
+    }
+    // only a fallback which is ready itself is bound, so fallback chains (and cycles) are never followed
+    const lvk::RenderPipelineHandle fallback = rps->desc_.fallbackPipeline;
+    if (fallback.valid() && ctx_->getVkPipeline(fallback, viewMask_, false) != VK_NULL_HANDLE) {
+      cmdBindRenderPipeline(fallback);
+      return;
+    }
+    skipDraws_ = true;
+    return;
+  }
+
+  skipDraws_ = false;
 
   if (lastPipelineBound_ != pipeline) {
     lastPipelineBound_ = pipeline;
+    if (commandList_) {
+      commandList_->pipelines_.emplace_back(handle, pipeline);
+    }
     vkCmdBindPipeline(wrapper_->cmdBuf_, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-    ctx_->bindDefaultDescriptorSets(wrapper_->cmdBuf_, VK_PIPELINE_BIND_POINT_GRAPHICS, rps->pipelineLayout_);
+    if (isSecondary_) {
+      // worker threads: another worker's getVkPipeline() can update the descriptor sets under this lock
+      std::lock_guard lock(ctx_->pimpl_->renderPipelinesMutex_);
+      ctx_->bindDefaultDescriptorSets(wrapper_->cmdBuf_, VK_PIPELINE_BIND_POINT_GRAPHICS, owner->pipelineLayout_);
+    } else {
+      ctx_->bindDefaultDescriptorSets(wrapper_->cmdBuf_, VK_PIPELINE_BIND_POINT_GRAPHICS, owner->pipelineLayout_);
+    }
     if (inputAttachments_.count) {
       vkCmdPushDescriptorSetKHR(wrapper_->cmdBuf_,
                                 VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                rps->pipelineLayout_,
+                                owner->pipelineLayout_,
                                 kDescriptorSet_InputAttachments,
                                 inputAttachments_.count,
                                 inputAttachments_.writes);
@@ -3018,6 +3513,14 @@ void lvk::CommandBuffer::cmdBindRenderPipeline(lvk::RenderPipelineHandle handle)
 void lvk::CommandBuffer::cmdBindDepthState(const DepthState& desc) {
   LVK_PROFILER_FUNCTION();
 
+  if (skipRedundantState(stateCache_.hasDepthState && stateCache_.depthState.compareOp == desc.compareOp &&
+                         stateCache_.depthState.isDepthWriteEnabled == desc.isDepthWriteEnabled)) {
+    return;
+  }
+
+  stateCache_.hasDepthState = true;
+  stateCache_.depthState = desc;
+
   const VkCompareOp op = compareOpToVkCompareOp(desc.compareOp);
   vkCmdSetDepthWriteEnable(wrapper_->cmdBuf_, desc.isDepthWriteEnabled ? VK_TRUE : VK_FALSE);
   vkCmdSetDepthTestEnable(wrapper_->cmdBuf_, (op != VK_COMPARE_OP_ALWAYS || desc.isDepthWriteEnabled) ? VK_TRUE : VK_FALSE);
@@ -3027,6 +3530,8 @@ void lvk::CommandBuffer::cmdBindDepthState(const DepthState& desc) {
   // On Android (Mali-G715-Immortalis MC11 v1.r38p1-01eac0.c1a71ccca2acf211eb87c5db5322f569)
   // if depth-stencil texture is not set, call of vkCmdSetDepthCompareOp leads to disappearing of all content.
   if (!framebuffer_.depthStencil.texture) {
+    // the compare op was not set, so this state cannot be reused by the next render pass
+    stateCache_.hasDepthState = false;
     return;
   }
 #endif
@@ -3044,6 +3549,18 @@ void lvk::CommandBuffer::cmdBindVertexBuffer(uint32_t index, BufferHandle buffer
 
   LVK_ASSERT(buf->vkUsageFlags_ & VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
 
+  if (!LVK_VERIFY(index < VertexInput::LVK_VERTEX_BUFFER_MAX)) {
+    return;
+  }
+
+  VertexBufferBinding& binding = stateCache_.vertexBuffers[index];
+
+  if (skipRedundantState(binding.buffer == buf->vkBuffer_ && binding.offset == bufferOffset && binding.size == bufferSize)) {
+    return;
+  }
+
+  binding = {buf->vkBuffer_, bufferOffset, bufferSize};
+
   vkCmdBindVertexBuffers2(wrapper_->cmdBuf_, index, 1, &buf->vkBuffer_, &bufferOffset, &bufferSize, nullptr);
 }
 
@@ -3053,11 +3570,22 @@ void lvk::CommandBuffer::cmdBindIndexBuffer(BufferHandle indexBuffer, IndexForma
   LVK_ASSERT(buf->vkUsageFlags_ & VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
 
   const VkIndexType type = indexFormatToVkIndexType(indexFormat);
-  vkCmdBindIndexBuffer2KHR(wrapper_->cmdBuf_, buf->vkBuffer_, bufferOffset, bufferSize, type); // TODO: remove KHR to update to Vulkan 1.4
-}
 
-void lvk::CommandBuffer::cmdPushConstants(const void* data, size_t size, size_t offset) {
-  LVK_PROFILER_FUNCTION();
+  const VertexBufferBinding& binding = stateCache_.indexBuffer;
+
+  if (skipRedundantState(binding.buffer == buf->vkBuffer_ && binding.offset == bufferOffset && binding.size == bufferSize &&
+                         stateCache_.indexType == type)) {
+    return;
+  }
+
+  stateCache_.indexBuffer = {buf->vkBuffer_, bufferOffset, bufferSize};
+  stateCache_.indexType = type;
+
+  vkCmdBindIndexBuffer2KHR(wrapper_->cmdBuf_, buf->vkBuffer_, bufferOffset, bufferSize, type); // TODO: remove KHR to update to Vulkan 1.4
+}
+
+void lvk::CommandBuffer::cmdPushConstants(const void* data, size_t size, size_t offset) {
+  LVK_PROFILER_FUNCTION();
 
   LVK_ASSERT(size % 4 == 0); // VUID-vkCmdPushConstants-size-00369: size must be a multiple of 4
 
@@ -3067,23 +3595,31 @@ void lvk::CommandBuffer::cmdPushConstants(const void* data, size_t size, size_t
     LLOGW("Push constants size exceeded %u (max %u bytes)", size + offset, limits.maxPushConstantsSize);
   }
 
-  if (currentPipelineGraphics_.empty() && currentPipelineCompute_.empty() && currentPipelineRayTracing_.empty()) {
-    LVK_ASSERT_MSG(false, "No pipeline bound - cannot set push constants");
+  if (lastPipelineLayout_ == VK_NULL_HANDLE) {
+    // a pipeline which failed to compile has no layout; its draws are skipped anyway
+    LVK_ASSERT_MSG(skipDraws_, "No pipeline bound - cannot set push constants");
     return;
   }
 
-  const lvk::RenderPipelineState* stateGraphics = ctx_->renderPipelinesPool_.get(currentPipelineGraphics_);
-  const lvk::ComputePipelineState* stateCompute = ctx_->computePipelinesPool_.get(currentPipelineCompute_);
-  const lvk::RayTracingPipelineState* stateRayTracing = ctx_->rayTracingPipelinesPool_.get(currentPipelineRayTracing_);
+  // push constants stay valid across pipelines with the same layout
+  const bool isCacheable = size + offset <= kMaxCachedPushConstantsSize;
 
-  LVK_ASSERT(stateGraphics || stateCompute || stateRayTracing);
+  if (skipRedundantState(isCacheable && stateCache_.pushConstantsLayout == lastPipelineLayout_ &&
+                         stateCache_.pushConstantsOffset == offset && stateCache_.pushConstantsSize == size &&
+                         !memcmp(stateCache_.pushConstants + offset, data, size))) {
+    return;
+  }
 
-  VkPipelineLayout layout = stateGraphics ? stateGraphics->pipelineLayout_
-                                          : (stateCompute ? stateCompute->pipelineLayout_ : stateRayTracing->pipelineLayout_);
-  VkShaderStageFlags shaderStageFlags = stateGraphics ? stateGraphics->shaderStageFlags_
-                                                      : (stateCompute ? VK_SHADER_STAGE_COMPUTE_BIT : stateRayTracing->shaderStageFlags_);
+  if (isCacheable) {
+    stateCache_.pushConstantsLayout = lastPipelineLayout_;
+    stateCache_.pushConstantsOffset = (uint32_t)offset;
+    stateCache_.pushConstantsSize = (uint32_t)size;
+    memcpy(stateCache_.pushConstants + offset, data, size);
+  } else {
+    stateCache_.pushConstantsLayout = VK_NULL_HANDLE;
+  }
 
-  vkCmdPushConstants(wrapper_->cmdBuf_, layout, shaderStageFlags, (uint32_t)offset, (uint32_t)size, data);
+  vkCmdPushConstants(wrapper_->cmdBuf_, lastPipelineLayout_, lastPushConstantsStageFlags_, (uint32_t)offset, (uint32_t)size, data);
 }
 
 void lvk::CommandBuffer::cmdFillBuffer(BufferHandle buffer, size_t bufferOffset, size_t size, uint32_t data) {
@@ -3200,7 +3736,7 @@ void lvk::CommandBuffer::cmdDraw(uint32_t vertexCount, uint32_t instanceCount, u
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDraw()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
-  if (vertexCount == 0) {
+  if (vertexCount == 0 || skipDraws_) {
     return;
   }
 
@@ -3215,7 +3751,7 @@ void lvk::CommandBuffer::cmdDrawIndexed(uint32_t indexCount,
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDrawIndexed()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
-  if (indexCount == 0) {
+  if (indexCount == 0 || skipDraws_) {
     return;
   }
 
@@ -3224,10 +3760,82 @@ void lvk::CommandBuffer::cmdDrawIndexed(uint32_t indexCount,
   vkCmdDrawIndexed(wrapper_->cmdBuf_, indexCount, instanceCount, firstIndex, vertexOffset, baseInstance);
 }
 
+void lvk::CommandBuffer::cmdDrawMulti(const ldr::Span<DrawRange>& draws, uint32_t instanceCount, uint32_t baseInstance) {
+  LVK_PROFILER_FUNCTION();
+  LVK_PROFILER_GPU_ZONE("cmdDrawMulti()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
+
+  static_assert(sizeof(DrawRange) == sizeof(VkMultiDrawInfoEXT));
+
+  if (draws.empty() || instanceCount == 0 || skipDraws_) {
+    return;
+  }
+
+  if (!ctx_->has_EXT_multi_draw_) {
+    for (const DrawRange& draw : draws) {
+      if (draw.vertexCount) {
+        vkCmdDraw(wrapper_->cmdBuf_, draw.vertexCount, instanceCount, draw.firstVertex, baseInstance);
+      }
+    }
+    return;
+  }
+
+  const uint32_t maxDrawCount = ctx_->vkMultiDrawProperties_.maxMultiDrawCount;
+  const uint32_t numDraws = (uint32_t)draws.size();
+
+  for (uint32_t i = 0; i < numDraws; i += maxDrawCount) {
+    vkCmdDrawMultiEXT(wrapper_->cmdBuf_,
+                      std::min(maxDrawCount, numDraws - i),
+                      reinterpret_cast<const VkMultiDrawInfoEXT*>(draws.data() + i),
+                      instanceCount,
+                      baseInstance,
+                      sizeof(DrawRange));
+  }
+}
+
+void lvk::CommandBuffer::cmdDrawMultiIndexed(const ldr::Span<DrawIndexedRange>& draws, uint32_t instanceCount, uint32_t baseInstance) {
+  LVK_PROFILER_FUNCTION();
+  LVK_PROFILER_GPU_ZONE("cmdDrawMultiIndexed()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
+
+  static_assert(sizeof(DrawIndexedRange) == sizeof(VkMultiDrawIndexedInfoEXT));
+
+  if (draws.empty() || instanceCount == 0 || skipDraws_) {
+    return;
+  }
+
+  LVK_ASSERT(ctx_->awaitingCreation_ == false);
+
+  if (!ctx_->has_EXT_multi_draw_) {
+    for (const DrawIndexedRange& draw : draws) {
+      if (draw.indexCount) {
+        vkCmdDrawIndexed(wrapper_->cmdBuf_, draw.indexCount, instanceCount, draw.firstIndex, draw.vertexOffset, baseInstance);
+      }
+    }
+    return;
+  }
+
+  const uint32_t maxDrawCount = ctx_->vkMultiDrawProperties_.maxMultiDrawCount;
+  const uint32_t numDraws = (uint32_t)draws.size();
+
+  // pVertexOffset == nullptr: every range uses its own vertexOffset
+  for (uint32_t i = 0; i < numDraws; i += maxDrawCount) {
+    vkCmdDrawMultiIndexedEXT(wrapper_->cmdBuf_,
+                             std::min(maxDrawCount, numDraws - i),
+                             reinterpret_cast<const VkMultiDrawIndexedInfoEXT*>(draws.data() + i),
+                             instanceCount,
+                             baseInstance,
+                             sizeof(DrawIndexedRange),
+                             nullptr);
+  }
+}
+
 void lvk::CommandBuffer::cmdDrawIndirect(BufferHandle indirectBuffer, size_t indirectBufferOffset, uint32_t drawCount, uint32_t stride) {
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDrawIndirect()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
+  if (skipDraws_) {
+    return;
+  }
+
   lvk::VulkanBuffer* bufIndirect = ctx_->buffersPool_.get(indirectBuffer);
 
   LVK_ASSERT(bufIndirect);
@@ -3243,6 +3851,10 @@ void lvk::CommandBuffer::cmdDrawIndexedIndirect(BufferHandle indirectBuffer,
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDrawIndexedIndirect()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
+  if (skipDraws_) {
+    return;
+  }
+
   lvk::VulkanBuffer* bufIndirect = ctx_->buffersPool_.get(indirectBuffer);
 
   LVK_ASSERT(bufIndirect);
@@ -3260,6 +3872,10 @@ void lvk::CommandBuffer::cmdDrawIndexedIndirectCount(BufferHandle indirectBuffer
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDrawIndexedIndirectCount()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
+  if (skipDraws_) {
+    return;
+  }
+
   lvk::VulkanBuffer* bufIndirect = ctx_->buffersPool_.get(indirectBuffer);
   lvk::VulkanBuffer* bufCount = ctx_->buffersPool_.get(countBuffer);
 
@@ -3279,6 +3895,10 @@ void lvk::CommandBuffer::cmdDrawMeshTasks(const Dimensions& threadgroupCount) {
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDrawMeshTasks()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
+  if (skipDraws_) {
+    return;
+  }
+
   LVK_ASSERT_MSG(ctx_->has_EXT_mesh_shader_, "Mesh shaders not supported\n");
 
   vkCmdDrawMeshTasksEXT(wrapper_->cmdBuf_, threadgroupCount.width, threadgroupCount.height, threadgroupCount.depth);
@@ -3291,6 +3911,10 @@ void lvk::CommandBuffer::cmdDrawMeshTasksIndirect(BufferHandle indirectBuffer,
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDrawMeshTasksIndirect()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
+  if (skipDraws_) {
+    return;
+  }
+
   LVK_ASSERT_MSG(ctx_->has_EXT_mesh_shader_, "Mesh shaders not supported\n");
 
   lvk::VulkanBuffer* bufIndirect = ctx_->buffersPool_.get(indirectBuffer);
@@ -3313,6 +3937,10 @@ void lvk::CommandBuffer::cmdDrawMeshTasksIndirectCount(BufferHandle indirectBuff
   LVK_PROFILER_FUNCTION();
   LVK_PROFILER_GPU_ZONE("cmdDrawMeshTasksIndirectCount()", ctx_, wrapper_->cmdBuf_, LVK_PROFILER_COLOR_CMD_DRAW);
 
+  if (skipDraws_) {
+    return;
+  }
+
   LVK_ASSERT_MSG(ctx_->has_EXT_mesh_shader_, "Mesh shaders not supported\n");
 
   lvk::VulkanBuffer* bufIndirect = ctx_->buffersPool_.get(indirectBuffer);
@@ -3361,6 +3989,15 @@ void lvk::CommandBuffer::cmdSetBlendColor(const float color[4]) {
 }
 
 void lvk::CommandBuffer::cmdSetDepthBias(float constantFactor, float slopeFactor, float clamp) {
+  const float depthBias[3] = {constantFactor, clamp, slopeFactor};
+
+  if (skipRedundantState(stateCache_.hasDepthBias && !memcmp(stateCache_.depthBias, depthBias, sizeof(depthBias)))) {
+    return;
+  }
+
+  stateCache_.hasDepthBias = true;
+  memcpy(stateCache_.depthBias, depthBias, sizeof(depthBias));
+
   vkCmdSetDepthBias(wrapper_->cmdBuf_, constantFactor, clamp, slopeFactor);
 }
 
@@ -3730,6 +4367,264 @@ void lvk::CommandBuffer::cmdUpdateTLAS(AccelStructHandle handle, BufferHandle in
   }
 }
 
+lvk::VulkanSecondaryCommands::VulkanSecondaryCommands(VulkanContext& ctx, uint32_t maxThreads) : ctx_(ctx) {
+  threads_.reserve(maxThreads);
+  for (uint32_t i = 0; i != maxThreads; i++) {
+    threads_.push_back(std::make_unique<ThreadCommands>());
+  }
+}
+
+lvk::VulkanSecondaryCommands::~VulkanSecondaryCommands() {
+  LVK_PROFILER_FUNCTION_COLOR(LVK_PROFILER_COLOR_DESTROY);
+
+  // the context waits for the device to become idle before destroying this
+  for (const std::unique_ptr<ThreadCommands>& thread : threads_) {
+    if (thread->pool != VK_NULL_HANDLE) {
+      vkDestroyCommandPool(ctx_.vkDevice_, thread->pool, nullptr);
+    }
+  }
+
+  if (commandListsPool_ != VK_NULL_HANDLE) {
+    vkDestroyCommandPool(ctx_.vkDevice_, commandListsPool_, nullptr);
+  }
+}
+
+lvk::CommandBuffer& lvk::VulkanSecondaryCommands::acquire(uint32_t threadIndex, const RenderPass& renderPass, const Framebuffer& fb) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT_MSG(threadIndex < threads_.size(), "`threadIndex` should be less than ContextConfig::maxRecordingThreads");
+
+  ThreadCommands& thread = *threads_[threadIndex];
+
+  std::lock_guard lock(thread.mutex);
+
+  if (thread.pool == VK_NULL_HANDLE) {
+    const VkCommandPoolCreateInfo ci = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+        .queueFamilyIndex = ctx_.deviceQueues_.graphicsQueueFamilyIndex,
+    };
+    VK_ASSERT(vkCreateCommandPool(ctx_.vkDevice_, &ci, nullptr, &thread.pool));
+    char poolName[256] = {0};
+    (void)snprintf(poolName, sizeof(poolName) - 1, "Command Pool: VulkanSecondaryCommands (thread %u)", threadIndex);
+    VK_ASSERT(lvk::setDebugObjectName(ctx_.vkDevice_, VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)thread.pool, poolName));
+  }
+
+  // query the timeline directly: the command buffer pool of VulkanImmediateCommands is owned by the render thread
+  uint64_t completedValue = 0;
+  VK_ASSERT(vkGetSemaphoreCounterValue(ctx_.vkDevice_, ctx_.immediate_->getTimelineSemaphore(), &completedValue));
+
+  Secondary* current = nullptr;
+
+  for (Secondary& buf : thread.buffers) {
+    const uint64_t value = buf.wrapper.signaledTimelineValue_;
+    if (!buf.wrapper.isEncoding_ && value && value <= completedValue) {
+      current = &buf;
+      break;
+    }
+  }
+
+  if (!current) {
+    // never stall on the GPU here: grow the pool of this thread instead
+    current = &thread.buffers.emplace_back();
+    const VkCommandBufferAllocateInfo ai = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = thread.pool,
+        .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+        .commandBufferCount = 1,
+    };
+    VK_ASSERT(vkAllocateCommandBuffers(ctx_.vkDevice_, &ai, &current->wrapper.cmdBufAllocated_));
+  }
+
+  current->wrapper.cmdBuf_ = current->wrapper.cmdBufAllocated_;
+  current->wrapper.signaledTimelineValue_ = 0;
+  current->wrapper.isEncoding_ = true;
+
+  begin(current->wrapper,
+        current->commandBuffer,
+        getRenderingInfo(renderPass, fb),
+        fb,
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        threadIndex);
+
+  return current->commandBuffer;
+}
+
+lvk::SecondaryRenderingInfo lvk::VulkanSecondaryCommands::getRenderingInfo(const RenderPass& renderPass, const Framebuffer& fb) const {
+  // the attachment formats have to match the render pass of the primary command buffer (see CommandBuffer::cmdBeginRendering())
+  SecondaryRenderingInfo info = {
+      .numColorFormats = fb.getNumColorAttachments(),
+      .viewMask = renderPass.viewMask,
+  };
+
+  uint32_t mipLevel = 0;
+  uint32_t fbWidth = 0;
+  uint32_t fbHeight = 0;
+
+  for (uint32_t i = 0; i != info.numColorFormats; i++) {
+    const lvk::VulkanImage& colorTexture = *ctx_.texturesPool_.get(fb.color[i].texture);
+    info.colorFormats[i] = colorTexture.vkImageFormat_;
+    info.samples = colorTexture.vkSamples_;
+    mipLevel = renderPass.color[i].level;
+    fbWidth = colorTexture.vkExtent_.width;
+    fbHeight = colorTexture.vkExtent_.height;
+  }
+  if (fb.depthStencil.texture) {
+    const lvk::VulkanImage& depthTexture = *ctx_.texturesPool_.get(fb.depthStencil.texture);
+    const bool isStencilFormat =
+        (renderPass.stencil.loadOp != lvk::LoadOp_DontCare) || (renderPass.stencil.storeOp != lvk::StoreOp_DontCare);
+    info.depthFormat = depthTexture.vkImageFormat_;
+    info.stencilFormat = isStencilFormat ? depthTexture.vkImageFormat_ : VK_FORMAT_UNDEFINED;
+    info.samples = depthTexture.vkSamples_;
+    mipLevel = renderPass.depth.level;
+    fbWidth = depthTexture.vkExtent_.width;
+    fbHeight = depthTexture.vkExtent_.height;
+  }
+
+  info.width = std::max(fbWidth >> mipLevel, 1u);
+  info.height = std::max(fbHeight >> mipLevel, 1u);
+
+  return info;
+}
+
+void lvk::VulkanSecondaryCommands::begin(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                                         CommandBuffer& commandBuffer,
+                                         const SecondaryRenderingInfo& info,
+                                         const Framebuffer& fb,
+                                         VkCommandBufferUsageFlags flags,
+                                         uint32_t threadIndex) {
+  const VkCommandBufferInheritanceRenderingInfo renderingInfo = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+      .viewMask = info.viewMask,
+      .colorAttachmentCount = info.numColorFormats,
+      .pColorAttachmentFormats = info.colorFormats,
+      .depthAttachmentFormat = info.depthFormat,
+      .stencilAttachmentFormat = info.stencilFormat,
+      .rasterizationSamples = info.samples,
+  };
+  const VkCommandBufferInheritanceInfo inheritanceInfo = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+      .pNext = &renderingInfo,
+  };
+  const VkCommandBufferBeginInfo bi = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+      .flags = flags | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+      .pInheritanceInfo = &inheritanceInfo,
+  };
+  VK_ASSERT(vkBeginCommandBuffer(wrapper.cmdBuf_, &bi));
+
+  commandBuffer = CommandBuffer(&ctx_, wrapper, fb, info.viewMask, threadIndex);
+
+  // dynamic state is not inherited from the primary command buffer: set the same defaults as cmdBeginRendering()
+  commandBuffer.cmdBindViewport({0.0f, 0.0f, (float)info.width, (float)info.height, 0.0f, +1.0f});
+  commandBuffer.cmdBindScissorRect({0, 0, info.width, info.height});
+  commandBuffer.cmdBindDepthState({});
+  vkCmdSetDepthBiasEnable(wrapper.cmdBuf_, VK_FALSE);
+}
+
+void lvk::VulkanSecondaryCommands::end(CommandBuffer& commandBuffer) {
+  LVK_ASSERT(commandBuffer.isSecondary_);
+  LVK_ASSERT(commandBuffer.wrapper_->isEncoding_);
+
+  VK_ASSERT(vkEndCommandBuffer(commandBuffer.wrapper_->cmdBuf_));
+
+  commandBuffer.wrapper_->isEncoding_ = false;
+}
+
+void lvk::VulkanSecondaryCommands::markSubmitted(const std::vector<const CommandBuffer*>& secondaries, uint64_t timelineValue) {
+  LVK_ASSERT(timelineValue);
+
+  for (const CommandBuffer* secondary : secondaries) {
+    ThreadCommands& thread = *threads_[secondary->secondaryThreadIndex_];
+    std::lock_guard lock(thread.mutex);
+    secondary->wrapper_->signaledTimelineValue_ = timelineValue;
+  }
+}
+
+bool lvk::VulkanSecondaryCommands::isValid(const CommandListState& list, const RenderPass& renderPass, const Framebuffer& fb) const {
+  if (list.wrapper_.cmdBuf_ == VK_NULL_HANDLE || list.descriptorSetsGeneration_ != ctx_.descriptorSetsGeneration_) {
+    return false;
+  }
+
+  if (list.renderingInfo_ != getRenderingInfo(renderPass, fb)) {
+    return false;
+  }
+
+  std::lock_guard lock(ctx_.pimpl_->renderPipelinesMutex_);
+
+  // getVkPipeline() re-creates VkPipelines on a new descriptor set layout, evicts old view mask variants, and finishes compilations
+  for (const auto& [handle, pipeline] : list.pipelines_) {
+    const lvk::RenderPipelineState* rps = ctx_.renderPipelinesPool_.get(handle);
+    if (rps && rps->owner_.valid()) {
+      rps = ctx_.renderPipelinesPool_.get(rps->owner_);
+    }
+    const lvk::RenderPipelineState::Variant* variant = rps ? rps->getVariant(renderPass.viewMask) : nullptr;
+    if (!variant || variant->pipeline != pipeline || (variant->compileJob && variant->compileJob->isReady())) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void lvk::VulkanSecondaryCommands::record(CommandListState& list, const RenderPass& renderPass, const Framebuffer& fb) {
+  LVK_PROFILER_FUNCTION();
+
+  if (commandListsPool_ == VK_NULL_HANDLE) {
+    const VkCommandPoolCreateInfo ci = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .queueFamilyIndex = ctx_.deviceQueues_.graphicsQueueFamilyIndex,
+    };
+    VK_ASSERT(vkCreateCommandPool(ctx_.vkDevice_, &ci, nullptr, &commandListsPool_));
+    VK_ASSERT(lvk::setDebugObjectName(
+        ctx_.vkDevice_, VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)commandListsPool_, "Command Pool: VulkanSecondaryCommands (command lists)"));
+  }
+
+  // the previous recording can still be executed by submissions in flight
+  destroy(list);
+
+  const VkCommandBufferAllocateInfo ai = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+      .commandPool = commandListsPool_,
+      .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+      .commandBufferCount = 1,
+  };
+  VK_ASSERT(vkAllocateCommandBuffers(ctx_.vkDevice_, &ai, &list.wrapper_.cmdBufAllocated_));
+  VK_ASSERT(lvk::setDebugObjectName(
+      ctx_.vkDevice_, VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)list.wrapper_.cmdBufAllocated_, list.debugName_));
+
+  list.wrapper_.cmdBuf_ = list.wrapper_.cmdBufAllocated_;
+  list.wrapper_.isEncoding_ = true;
+  list.renderingInfo_ = getRenderingInfo(renderPass, fb);
+  list.pipelines_.clear();
+
+  // executed by several frames in flight at the same time
+  CommandBuffer cmdBuffer;
+  begin(list.wrapper_, cmdBuffer, list.renderingInfo_, fb, VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT, 0);
+  cmdBuffer.commandList_ = &list;
+
+  list.record_(cmdBuffer);
+
+  end(cmdBuffer);
+
+  // binding a render pipeline brings the descriptor sets up to date, so take the generation after recording
+  list.descriptorSetsGeneration_ = ctx_.descriptorSetsGeneration_;
+}
+
+void lvk::VulkanSecondaryCommands::destroy(CommandListState& list) {
+  if (list.wrapper_.cmdBufAllocated_ == VK_NULL_HANDLE) {
+    return;
+  }
+
+  ctx_.deferredTask(std::packaged_task<void()>(
+      [device = ctx_.vkDevice_, pool = commandListsPool_, cmdBuf = list.wrapper_.cmdBufAllocated_]() {
+        vkFreeCommandBuffers(device, pool, 1, &cmdBuf);
+      }));
+
+  list.wrapper_.cmdBuf_ = VK_NULL_HANDLE;
+  list.wrapper_.cmdBufAllocated_ = VK_NULL_HANDLE;
+}
+
 lvk::VulkanStagingDevice::VulkanStagingDevice(VulkanContext& ctx) : ctx_(ctx) {
   LVK_PROFILER_FUNCTION();
 
@@ -3740,19 +4635,53 @@ lvk::VulkanStagingDevice::VulkanStagingDevice(VulkanContext& ctx) : ctx_(ctx) {
   // clamped to the max limits
   maxBufferSize_ = std::min(maxMemoryAllocationSize, ctx_.config_.maxStagingBufferSize);
   minBufferSize_ = std::min(minBufferSize_, maxBufferSize_);
+
+  // reservations are made from any thread, so the ring cannot be created lazily
+  if (ctx_.config_.stagingReservationRingSize) {
+    reservationBufferSize_ =
+        getAlignedSize(std::min(ctx_.config_.stagingReservationRingSize, maxMemoryAllocationSize), kStagingBufferAlignment);
+    reservationBuffer_ = {&ctx_,
+                          ctx_.createBuffer(reservationBufferSize_,
+                                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                            nullptr,
+                                            "Buffer: staging reservation ring")};
+    LVK_ASSERT(!reservationBuffer_.empty());
+    // cached here: worker threads cannot touch the buffers pool
+    reservationMappedPtr_ = ctx_.buffersPool_.get(reservationBuffer_)->getMappedPtr();
+  }
+}
+
+void lvk::VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer, size_t dstOffset, size_t size, const void* data, bool isInitialData) {
+  uploadBufferSubData(buffer, dstOffset, size, data, nullptr, isInitialData);
+}
+
+bool lvk::VulkanStagingDevice::bufferSubDataFromFile(VulkanBuffer& buffer, size_t dstOffset, size_t size, FILE* file) {
+  return uploadBufferSubData(buffer, dstOffset, size, nullptr, file, false);
 }
 
-void lvk::VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer, size_t dstOffset, size_t size, const void* data) {
+bool lvk::VulkanStagingDevice::uploadBufferSubData(VulkanBuffer& buffer,
+                                                   size_t dstOffset,
+                                                   size_t size,
+                                                   const void* data,
+                                                   FILE* file,
+                                                   bool isInitialData) {
   LVK_PROFILER_FUNCTION();
 
   if (buffer.isMapped()) {
+    if (file) {
+      return buffer.bufferSubData(ctx_, dstOffset, size, file);
+    }
     buffer.bufferSubData(ctx_, dstOffset, size, data);
-    return;
+    return true;
   }
 
   // capture the destination handle: an oversized upload grows the staging buffer below (prevent dangling buffer references)
   const VkBuffer dstVkBuffer = buffer.vkBuffer_;
 
+  // a new buffer is not used by the graphics queue yet, so there is no write-after-read hazard across queues
+  const bool useTransferQueue = isInitialData && ctx_.immediateTransfer_;
+
   const size_t origDstOffset = dstOffset;
   const size_t origSize = size;
 
@@ -3767,8 +4696,15 @@ void lvk::VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer, size_t dstOff
 
     LVK_ASSERT(stagingBuffer);
 
-    // copy data into staging buffer
-    stagingBuffer->bufferSubData(ctx_, desc.offset_, chunkSize, data);
+    // copy data into staging buffer (a file is read straight into the mapped staging memory)
+    if (file) {
+      if (!stagingBuffer->bufferSubData(ctx_, desc.offset_, chunkSize, file)) {
+        // nothing was recorded for this region: it is not inserted and its bytes are reused once the ring wraps around
+        return false;
+      }
+    } else {
+      stagingBuffer->bufferSubData(ctx_, desc.offset_, chunkSize, data);
+    }
 
     // do the transfer
     const VkBufferCopy copy = {
@@ -3777,10 +4713,12 @@ void lvk::VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer, size_t dstOff
         .size = chunkSize,
     };
 
-    const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = ctx_.immediate_->acquire();
+    const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = acquireCommandBuffer(useTransferQueue);
     vkCmdCopyBuffer(wrapper.cmdBuf_, stagingBuffer->vkBuffer_, dstVkBuffer, 1, &copy);
     // one barrier covering the full destination range
-    if (isLast) {
+    if (isLast && useTransferQueue) {
+      releaseBufferOwnership(wrapper, dstVkBuffer, origDstOffset, origSize);
+    } else if (isLast) {
       const VkBufferMemoryBarrier2 barrier = {
           .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
           .srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT,
@@ -3800,13 +4738,18 @@ void lvk::VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer, size_t dstOff
       };
       vkCmdPipelineBarrier2(wrapper.cmdBuf_, &depInfo);
     }
-    desc.handle_ = ctx_.immediate_->submit(wrapper);
+    desc.handle_ = submitCommandBuffer(wrapper);
     insertRegion(desc);
+    addStagedChunk(chunkSize);
 
     size -= chunkSize;
-    data = (uint8_t*)data + chunkSize;
+    if (data) {
+      data = (uint8_t*)data + chunkSize;
+    }
     dstOffset += chunkSize;
   }
+
+  return true;
 }
 
 void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
@@ -3818,6 +4761,30 @@ void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
                                            VkFormat format,
                                            const void* data,
                                            uint32_t bufferRowLength) {
+  uploadImageData2D(image, imageRegion, baseMipLevel, numMipLevels, baseLayer, numLayers, format, data, nullptr, bufferRowLength);
+}
+
+bool lvk::VulkanStagingDevice::imageData2DFromFile(VulkanImage& image,
+                                                   const VkRect2D& imageRegion,
+                                                   uint32_t baseMipLevel,
+                                                   uint32_t numMipLevels,
+                                                   uint32_t baseLayer,
+                                                   uint32_t numLayers,
+                                                   VkFormat format,
+                                                   FILE* file) {
+  return uploadImageData2D(image, imageRegion, baseMipLevel, numMipLevels, baseLayer, numLayers, format, nullptr, file, 0);
+}
+
+bool lvk::VulkanStagingDevice::uploadImageData2D(VulkanImage& image,
+                                                 const VkRect2D& imageRegion,
+                                                 uint32_t baseMipLevel,
+                                                 uint32_t numMipLevels,
+                                                 uint32_t baseLayer,
+                                                 uint32_t numLayers,
+                                                 VkFormat format,
+                                                 const void* data,
+                                                 FILE* file,
+                                                 uint32_t bufferRowLength) {
   LVK_PROFILER_FUNCTION();
 
   LVK_ASSERT(numMipLevels <= LVK_MAX_MIP_LEVELS);
@@ -3837,7 +4804,7 @@ void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
     LVK_ASSERT_MSG(coversFullImage, "Uploading mip-levels with an image region that is smaller than the base mip-level is not supported");
   }
 
-  // Fast path: copy from host memory (no staging buffer or submit) using VK_EXT_host_image_copy.
+  // Fast path: copy from host memory (no staging buffer or submit) using VK_EXT_host_image_copy. Files are always read into staging memory.
   //
   // Only the 1st, full-image upload of a freshly created image (layout still UNDEFINED): host image copies are NOT synced, so
   // re-uploading a texture the GPU may still be sampling would race.
@@ -3848,7 +4815,7 @@ void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
   const bool isSingleAspect = (hostCopyAspect & (hostCopyAspect - 1)) == 0;
   const bool isSinglePlane = lvk::getNumImagePlanes(image.vkImageFormat_) == 1; // multi-planar images fall through to the staging path
   const bool hasHostTransfer = image.vkUsageFlags_ & VK_IMAGE_USAGE_HOST_TRANSFER_BIT;
-  if (isFirstUpload && isSingleAspect && isSinglePlane && hasHostTransfer) {
+  if (!file && isFirstUpload && isSingleAspect && isSinglePlane && hasHostTransfer) {
     std::vector<VkMemoryToImageCopy> regions;
     regions.reserve((size_t)numMipLevels * numLayers);
 
@@ -3898,37 +4865,75 @@ void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
     VK_ASSERT(vkCopyMemoryToImage(ctx_.vkDevice_, &copyInfo));
 
     image.vkImageLayout_ = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-    return;
+    return true;
   }
 
-  // find the storage size for all mip-levels being uploaded
-  uint32_t layerStorageSize = 0;
-  for (uint32_t i = 0; i < numMipLevels; ++i) {
-    const uint32_t mipSize =
-        lvk::getTextureBytesPerLayer(bufferRowLength ? bufferRowLength : imageRegion.extent.width, imageRegion.extent.height, texFormat, i);
-    layerStorageSize += mipSize;
-  }
+  const uint64_t storageSize = getImageStorageSize2D(
+      bufferRowLength ? bufferRowLength : imageRegion.extent.width, imageRegion.extent.height, texFormat, numMipLevels, numLayers);
 
-  const uint64_t storageSize = (uint64_t)layerStorageSize * numLayers;
+  // No support for copying image in multiple smaller chunk sizes. Anything larger than the ring goes through a dedicated staging buffer.
+  lvk::Holder<BufferHandle> oversizeBuffer;
+  if (storageSize > maxBufferSize_) {
+    oversizeBuffer = createOversizeStagingBuffer(storageSize);
+  }
+  MemoryRegionDesc desc = oversizeBuffer.empty() ? getNextFreeOffset(storageSize) : MemoryRegionDesc{0, storageSize, SubmitHandle()};
+  LVK_ASSERT(desc.size_ >= storageSize);
 
-  ensureStagingBufferSize(storageSize);
+  // the 1st full upload of a new image can go to the transfer queue (dedicated buffers are released on the graphics timeline)
+  const bool useTransferQueue = isFirstUpload && oversizeBuffer.empty() && ctx_.immediateTransfer_ &&
+                                hasAlignedImageRegions2D(imageRegion, baseMipLevel, numMipLevels, numLayers, format);
 
-  LVK_ASSERT(storageSize <= stagingBufferSize_);
+  lvk::VulkanBuffer* stagingBuffer = ctx_.buffersPool_.get(oversizeBuffer.empty() ? stagingBuffer_ : oversizeBuffer);
 
-  MemoryRegionDesc desc = getNextFreeOffset(storageSize);
-  // No support for copying image in multiple smaller chunk sizes. If we get smaller buffer size than storageSize, we will wait for GPU idle
-  // and get bigger chunk.
-  if (desc.size_ < storageSize) {
-    waitAndReset();
-    desc = getNextFreeOffset(storageSize);
+  if (file) {
+    if (!stagingBuffer->bufferSubData(ctx_, desc.offset_, storageSize, file)) {
+      // nothing was recorded: the ring region is not inserted and its bytes are reused once the ring wraps around
+      return false;
+    }
+  } else {
+    stagingBuffer->bufferSubData(ctx_, desc.offset_, storageSize, data);
+  }
+
+  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = acquireCommandBuffer(useTransferQueue);
+
+  recordImageData2D(wrapper,
+                    image,
+                    imageRegion,
+                    baseMipLevel,
+                    numMipLevels,
+                    baseLayer,
+                    numLayers,
+                    format,
+                    stagingBuffer->vkBuffer_,
+                    desc.offset_,
+                    bufferRowLength,
+                    useTransferQueue);
+
+  desc.handle_ = submitCommandBuffer(wrapper);
+  if (oversizeBuffer.empty()) {
+    insertRegion(desc);
   }
-  LVK_ASSERT(desc.size_ >= storageSize);
+  addStagedChunk(storageSize);
 
-  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = ctx_.immediate_->acquire();
-
-  lvk::VulkanBuffer* stagingBuffer = ctx_.buffersPool_.get(stagingBuffer_);
+  return true;
+}
 
-  stagingBuffer->bufferSubData(ctx_, desc.offset_, storageSize, data);
+void lvk::VulkanStagingDevice::recordImageData2D(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                                                 VulkanImage& image,
+                                                 const VkRect2D& imageRegion,
+                                                 uint32_t baseMipLevel,
+                                                 uint32_t numMipLevels,
+                                                 uint32_t baseLayer,
+                                                 uint32_t numLayers,
+                                                 VkFormat format,
+                                                 VkBuffer srcBuffer,
+                                                 VkDeviceSize srcOffset,
+                                                 uint32_t bufferRowLength,
+                                                 bool useTransferQueue) {
+  const Format texFormat = vkFormatToFormat(format);
+  const bool coversFullImage = !imageRegion.offset.x && !imageRegion.offset.y &&
+                               imageRegion.extent.width == (image.vkExtent_.width >> baseMipLevel) &&
+                               imageRegion.extent.height == (image.vkExtent_.height >> baseMipLevel);
 
   uint32_t offset = 0;
 
@@ -3990,7 +4995,7 @@ void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
         const VkBufferImageCopy2 copy = {
             .sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2,
             // the offset for this level is at the start of all mip-levels plus the size of all previous mip-levels being uploaded
-            .bufferOffset = desc.offset_ + offset + planeOffset,
+            .bufferOffset = srcOffset + offset + planeOffset,
             .bufferRowLength = bufferRowLength,
             .bufferImageHeight = 0,
             .imageSubresource =
@@ -4001,7 +5006,7 @@ void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
         };
         const VkCopyBufferToImageInfo2 copyInfo = {
             .sType = VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2,
-            .srcBuffer = stagingBuffer->vkBuffer_,
+            .srcBuffer = srcBuffer,
             .dstImage = image.vkImage_,
             .dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             .regionCount = 1,
@@ -4012,23 +5017,53 @@ void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
       }
 
       // 3. Transition TRANSFER_DST_OPTIMAL into SHADER_READ_ONLY_OPTIMAL
-      lvk::imageMemoryBarrier2(
-          wrapper.cmdBuf_,
-          image.vkImage_,
-          StageAccess{.stage = VK_PIPELINE_STAGE_2_TRANSFER_BIT, .access = VK_ACCESS_2_TRANSFER_WRITE_BIT},
-          StageAccess{.stage = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, .access = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT},
-          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-          VkImageSubresourceRange{imageAspect, currentMipLevel, 1, currentLayer, 1});
+      if (useTransferQueue) {
+        releaseImageOwnership(wrapper,
+                              image.vkImage_,
+                              VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                              VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                              VkImageSubresourceRange{imageAspect, currentMipLevel, 1, currentLayer, 1});
+      } else {
+        lvk::imageMemoryBarrier2(wrapper.cmdBuf_,
+                                 image.vkImage_,
+                                 StageAccess{.stage = VK_PIPELINE_STAGE_2_TRANSFER_BIT, .access = VK_ACCESS_2_TRANSFER_WRITE_BIT},
+                                 StageAccess{.stage = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                                             .access = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT},
+                                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                 VkImageSubresourceRange{imageAspect, currentMipLevel, 1, currentLayer, 1});
+      }
 
       offset += lvk::getTextureBytesPerLayer(imageRegion.extent.width, imageRegion.extent.height, texFormat, currentMipLevel);
     }
   }
 
   image.vkImageLayout_ = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+}
 
-  desc.handle_ = ctx_.immediate_->submit(wrapper);
-  insertRegion(desc);
+bool lvk::VulkanStagingDevice::hasAlignedImageRegions2D(const VkRect2D& imageRegion,
+                                                       uint32_t baseMipLevel,
+                                                       uint32_t numMipLevels,
+                                                       uint32_t numLayers,
+                                                       VkFormat format) {
+  const Format texFormat = vkFormatToFormat(format);
+  const uint32_t numPlanes = lvk::getNumImagePlanes(format);
+
+  // the same offsets as in recordImageData2D(), the staging region itself is aligned to kStagingBufferAlignment
+  uint32_t offset = 0;
+  for (uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel) {
+    for (uint32_t layer = 0; layer != numLayers; layer++) {
+      uint32_t planeOffset = 0;
+      for (uint32_t plane = 0; plane != numPlanes; plane++) {
+        if ((offset + planeOffset) % 4) {
+          return false;
+        }
+        planeOffset += lvk::getTextureBytesPerPlane(imageRegion.extent.width, imageRegion.extent.height, texFormat, plane);
+      }
+      offset += lvk::getTextureBytesPerLayer(imageRegion.extent.width, imageRegion.extent.height, texFormat, baseMipLevel + mipLevel);
+    }
+  }
+  return true;
 }
 
 void lvk::VulkanStagingDevice::imageData3D(VulkanImage& image,
@@ -4039,6 +5074,40 @@ void lvk::VulkanStagingDevice::imageData3D(VulkanImage& image,
   LVK_PROFILER_FUNCTION();
   LVK_ASSERT_MSG(image.numLevels_ == 1, "Can handle only 3D images with exactly 1 mip-level");
 
+  // Fast path: the 1st upload of a freshly created image is copied from host memory using VK_EXT_host_image_copy (see imageData2D())
+  const bool hasHostTransfer = image.vkUsageFlags_ & VK_IMAGE_USAGE_HOST_TRANSFER_BIT;
+  if (hasHostTransfer && image.vkImageLayout_ == VK_IMAGE_LAYOUT_UNDEFINED) {
+    const VkHostImageLayoutTransitionInfo transition = {
+        .sType = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO,
+        .image = image.vkImage_,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1},
+    };
+    VK_ASSERT(vkTransitionImageLayout(ctx_.vkDevice_, 1, &transition));
+
+    const VkMemoryToImageCopy region = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY,
+        .pHostPointer = data,
+        .memoryRowLength = 0,
+        .memoryImageHeight = 0,
+        .imageSubresource = VkImageSubresourceLayers{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1},
+        .imageOffset = offset,
+        .imageExtent = extent,
+    };
+    const VkCopyMemoryToImageInfo copyInfo = {
+        .sType = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO,
+        .dstImage = image.vkImage_,
+        .dstImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .regionCount = 1,
+        .pRegions = &region,
+    };
+    VK_ASSERT(vkCopyMemoryToImage(ctx_.vkDevice_, &copyInfo));
+
+    image.vkImageLayout_ = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    return;
+  }
+
   const uint64_t sliceBytes64 = (uint64_t)extent.width * extent.height * getBytesPerPixel(format);
   LVK_ASSERT_MSG(sliceBytes64 <= UINT32_MAX, "Single depth slice exceeds 4 GB");
   const uint32_t sliceBytes = (uint32_t)sliceBytes64;
@@ -4051,22 +5120,27 @@ void lvk::VulkanStagingDevice::imageData3D(VulkanImage& image,
   uint32_t remainingSlices = extent.depth;
   uint32_t currentZ = offset.z;
 
-  lvk::VulkanBuffer* stagingBuffer = ctx_.buffersPool_.get(stagingBuffer_);
+  // a new 3D image is not used by the graphics queue yet (the whole upload stays on one queue)
+  const bool isFirstUpload = image.vkImageLayout_ == VK_IMAGE_LAYOUT_UNDEFINED;
+  const bool useTransferQueue = isFirstUpload && ctx_.immediateTransfer_ && (VkDeviceSize)sliceBytes * maxSlicesPerBatch <= maxBufferSize_;
 
   while (remainingSlices) {
     const uint32_t batchSlices = std::min(remainingSlices, maxSlicesPerBatch);
     const VkDeviceSize batchBytes = (VkDeviceSize)batchSlices * sliceBytes;
 
-    MemoryRegionDesc desc = getNextFreeOffset(batchBytes);
-    if (desc.size_ < batchBytes) {
-      waitAndReset();
-      desc = getNextFreeOffset(batchBytes);
+    // a single depth slice can still be larger than the entire ring
+    lvk::Holder<BufferHandle> oversizeBuffer;
+    if (batchBytes > maxBufferSize_) {
+      oversizeBuffer = createOversizeStagingBuffer(batchBytes);
     }
+    MemoryRegionDesc desc = oversizeBuffer.empty() ? getNextFreeOffset(batchBytes) : MemoryRegionDesc{0, batchBytes, SubmitHandle()};
     LVK_ASSERT(desc.size_ >= batchBytes);
 
+    lvk::VulkanBuffer* stagingBuffer = ctx_.buffersPool_.get(oversizeBuffer.empty() ? stagingBuffer_ : oversizeBuffer);
+
     stagingBuffer->bufferSubData(ctx_, desc.offset_, batchBytes, srcPtr);
 
-    const auto& wrapper = ctx_.immediate_->acquire();
+    const auto& wrapper = acquireCommandBuffer(useTransferQueue);
 
     // first batch: transition the whole image UNDEFINED -> TRANSFER_DST_OPTIMAL
     if (remainingSlices == extent.depth) {
@@ -4099,7 +5173,13 @@ void lvk::VulkanStagingDevice::imageData3D(VulkanImage& image,
     vkCmdCopyBufferToImage2(wrapper.cmdBuf_, &copyInfo);
 
     // last batch: transition the whole image TRANSFER_DST_OPTIMAL -> SHADER_READ_ONLY_OPTIMAL
-    if (remainingSlices == batchSlices) {
+    if (remainingSlices == batchSlices && useTransferQueue) {
+      releaseImageOwnership(wrapper,
+                            image.vkImage_,
+                            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                            VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+    } else if (remainingSlices == batchSlices) {
       lvk::imageMemoryBarrier2(
           wrapper.cmdBuf_,
           image.vkImage_,
@@ -4110,8 +5190,11 @@ void lvk::VulkanStagingDevice::imageData3D(VulkanImage& image,
           VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
     }
 
-    desc.handle_ = ctx_.immediate_->submit(wrapper);
-    insertRegion(desc);
+    desc.handle_ = submitCommandBuffer(wrapper);
+    if (oversizeBuffer.empty()) {
+      insertRegion(desc);
+    }
+    addStagedChunk(batchBytes);
 
     srcPtr += batchBytes;
     currentZ += batchSlices;
@@ -4127,34 +5210,165 @@ void lvk::VulkanStagingDevice::getImageData(VulkanImage& image,
                                             VkImageSubresourceRange range,
                                             VkFormat format,
                                             void* outData) {
-  LVK_ASSERT(image.vkImageLayout_ != VK_IMAGE_LAYOUT_UNDEFINED);
-  LVK_ASSERT(range.layerCount == 1);
+  LVK_PROFILER_FUNCTION();
 
-  const uint64_t storageSize = (uint64_t)extent.width * extent.height * extent.depth * getBytesPerPixel(format);
+  // Fast path: copy straight into host memory using VK_EXT_host_image_copy (no readback buffer, no copy commands).
+  //
+  // Host image copies are NOT synced, so wait for all the GPU work submitted so far (like the readback submit below effectively does).
+  // HOST_TRANSFER images are never storage images or attachments, so only uploads and mip-map generation can write into them.
+  const VkImageAspectFlags hostCopyAspect = range.aspectMask;
+  const bool isSingleAspect = (hostCopyAspect & (hostCopyAspect - 1)) == 0;
+  const bool hasHostTransfer = image.vkUsageFlags_ & VK_IMAGE_USAGE_HOST_TRANSFER_BIT;
+  if (hasHostTransfer && isSingleAspect && ctx_.hostImageCopyFromShaderReadOnly_ &&
+      image.vkImageLayout_ == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+    flushBatch();
+    flushPendingAcquires();
+    for (lvk::VulkanImmediateCommands* immediate : {ctx_.immediate_.get(), ctx_.immediateTransfer_.get()}) {
+      // an empty handle would wait for the entire device
+      if (immediate && !immediate->getLastSubmitHandle().empty()) {
+        immediate->wait(immediate->getLastSubmitHandle());
+      }
+    }
 
-  ensureStagingBufferSize(storageSize);
+    // `outData` is laid out layer after layer
+    const uint64_t layerSize = (uint64_t)extent.width * extent.height * extent.depth * getBytesPerPixel(format);
 
-  LVK_ASSERT(storageSize <= stagingBufferSize_);
+    std::vector<VkImageToMemoryCopy> regions;
+    regions.reserve(range.layerCount);
 
-  // get next staging buffer free offset
-  MemoryRegionDesc desc = getNextFreeOffset(storageSize);
+    for (uint32_t layer = 0; layer != range.layerCount; layer++) {
+      regions.push_back(VkImageToMemoryCopy{
+          .sType = VK_STRUCTURE_TYPE_IMAGE_TO_MEMORY_COPY,
+          .pHostPointer = (uint8_t*)outData + layer * layerSize,
+          .memoryRowLength = 0,
+          .memoryImageHeight = 0,
+          .imageSubresource = VkImageSubresourceLayers{hostCopyAspect, range.baseMipLevel, range.baseArrayLayer + layer, 1},
+          .imageOffset = offset,
+          .imageExtent = extent,
+      });
+    }
 
-  // No support for copying image in multiple smaller chunk sizes.
-  // If we get smaller buffer size than storageSize, we will wait for GPU idle and get a bigger chunk.
-  if (desc.size_ < storageSize) {
-    waitAndReset();
-    desc = getNextFreeOffset(storageSize);
+    const VkCopyImageToMemoryInfo copyInfo = {
+        .sType = VK_STRUCTURE_TYPE_COPY_IMAGE_TO_MEMORY_INFO,
+        .srcImage = image.vkImage_,
+        .srcImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .regionCount = (uint32_t)regions.size(),
+        .pRegions = regions.data(),
+    };
+    VK_ASSERT(vkCopyImageToMemory(ctx_.vkDevice_, &copyInfo));
+    return;
   }
 
-  LVK_ASSERT(desc.size_ >= storageSize);
+  const ReadbackTicket ticket = readbackImage(image, offset, extent, range, format);
+
+  // the copy might have been recorded into an open upload batch
+  flushBatch();
+
+  ctx_.immediate_->wait(ticket.handle);
+
+  memcpy(outData, getReadbackData(ticket), ticket.size);
+
+  releaseReadback(ticket);
+}
+
+void lvk::VulkanStagingDevice::getBufferData(VulkanBuffer& buffer, size_t offset, size_t size, void* outData) {
+  LVK_PROFILER_FUNCTION();
 
-  lvk::VulkanBuffer* stagingBuffer = ctx_.buffersPool_.get(stagingBuffer_);
+  const ReadbackTicket ticket = readbackBuffer(buffer, offset, size);
 
-  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper1 = ctx_.immediate_->acquire();
+  // the copy might have been recorded into an open upload batch
+  flushBatch();
+
+  ctx_.immediate_->wait(ticket.handle);
+
+  memcpy(outData, getReadbackData(ticket), ticket.size);
+
+  releaseReadback(ticket);
+}
+
+lvk::ReadbackTicket lvk::VulkanStagingDevice::readbackBuffer(VulkanBuffer& buffer, size_t offset, size_t size) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT(buffer.vkUsageFlags_ & VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+  // capture the source handle: a dedicated readback buffer may be created below (prevent dangling buffer references)
+  const VkBuffer srcVkBuffer = buffer.vkBuffer_;
+
+  ReadbackRegionDesc& desc = allocateReadback(size);
+
+  lvk::VulkanBuffer* readbackBuffer = ctx_.buffersPool_.get(desc.dedicatedBuffer_.empty() ? readbackBuffer_ : desc.dedicatedBuffer_);
+
+  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = acquireCommandBuffer();
+
+  // 1. Wait for all previous writes into the source buffer
+  const VkBufferMemoryBarrier2 barrier = {
+      .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+      .srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+      .srcAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT,
+      .dstStageMask = VK_PIPELINE_STAGE_2_COPY_BIT,
+      .dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT,
+      .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+      .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+      .buffer = srcVkBuffer,
+      .offset = offset,
+      .size = size,
+  };
+  const VkDependencyInfo depInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+      .bufferMemoryBarrierCount = 1,
+      .pBufferMemoryBarriers = &barrier,
+  };
+  vkCmdPipelineBarrier2(wrapper.cmdBuf_, &depInfo);
+
+  // 2. Copy the data into the readback buffer
+  const VkBufferCopy copy = {
+      .srcOffset = offset,
+      .dstOffset = desc.offset_,
+      .size = size,
+  };
+  vkCmdCopyBuffer(wrapper.cmdBuf_, srcVkBuffer, readbackBuffer->vkBuffer_, 1, &copy);
+
+  // 3. Make the copied data available to the host
+  const VkMemoryBarrier2 hostBarrier = {
+      .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+      .srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT,
+      .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+      .dstStageMask = VK_PIPELINE_STAGE_2_HOST_BIT,
+      .dstAccessMask = VK_ACCESS_2_HOST_READ_BIT,
+  };
+  const VkDependencyInfo hostDepInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+      .memoryBarrierCount = 1,
+      .pMemoryBarriers = &hostBarrier,
+  };
+  vkCmdPipelineBarrier2(wrapper.cmdBuf_, &hostDepInfo);
+
+  desc.handle_ = submitCommandBuffer(wrapper);
+
+  return {.handle = desc.handle_, .id = desc.id_, .size = size};
+}
+
+lvk::ReadbackTicket lvk::VulkanStagingDevice::readbackImage(VulkanImage& image,
+                                                            const VkOffset3D& offset,
+                                                            const VkExtent3D& extent,
+                                                            VkImageSubresourceRange range,
+                                                            VkFormat format) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT(image.vkImageLayout_ != VK_IMAGE_LAYOUT_UNDEFINED);
+  LVK_ASSERT(range.layerCount == 1);
+
+  const uint64_t storageSize = (uint64_t)extent.width * extent.height * extent.depth * getBytesPerPixel(format);
+
+  ReadbackRegionDesc& desc = allocateReadback(storageSize);
+
+  lvk::VulkanBuffer* readbackBuffer = ctx_.buffersPool_.get(desc.dedicatedBuffer_.empty() ? readbackBuffer_ : desc.dedicatedBuffer_);
+
+  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = acquireCommandBuffer();
 
   // 1. Transition to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
   lvk::imageMemoryBarrier2(
-      wrapper1.cmdBuf_,
+      wrapper.cmdBuf_,
       image.vkImage_,
       StageAccess{.stage = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT, .access = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT},
       StageAccess{.stage = VK_PIPELINE_STAGE_2_TRANSFER_BIT, .access = VK_ACCESS_2_TRANSFER_READ_BIT},
@@ -4162,7 +5376,7 @@ void lvk::VulkanStagingDevice::getImageData(VulkanImage& image,
       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
       range);
 
-  // 2.  Copy the pixel data from the image into the staging buffer
+  // 2. Copy the pixel data from the image into the readback buffer
   const VkBufferImageCopy2 copy = {
       .sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2,
       .bufferOffset = desc.offset_,
@@ -4182,55 +5396,432 @@ void lvk::VulkanStagingDevice::getImageData(VulkanImage& image,
       .sType = VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2,
       .srcImage = image.vkImage_,
       .srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-      .dstBuffer = stagingBuffer->vkBuffer_,
+      .dstBuffer = readbackBuffer->vkBuffer_,
       .regionCount = 1,
       .pRegions = &copy,
   };
-  vkCmdCopyImageToBuffer2(wrapper1.cmdBuf_, &copyInfo);
-
-  desc.handle_ = ctx_.immediate_->submit(wrapper1);
-  insertRegion(desc);
-
-  waitAndReset();
-
-  if (!stagingBuffer->isCoherentMemory_) {
-    stagingBuffer->invalidateMappedMemory(ctx_, desc.offset_, desc.size_);
-  }
-
-  // 3. Copy data from staging buffer into data
-  memcpy(outData, stagingBuffer->getMappedPtr() + desc.offset_, storageSize);
-
-  // 4. Transition back to the initial image layout
-  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper2 = ctx_.immediate_->acquire();
+  vkCmdCopyImageToBuffer2(wrapper.cmdBuf_, &copyInfo);
 
+  // 3. Transition back to the initial image layout in the same command buffer
   lvk::imageMemoryBarrier2(
-      wrapper2.cmdBuf_,
+      wrapper.cmdBuf_,
       image.vkImage_,
       StageAccess{.stage = VK_PIPELINE_STAGE_2_TRANSFER_BIT, .access = VK_ACCESS_2_TRANSFER_READ_BIT},
-      StageAccess{.stage = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, .access = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT},
+      StageAccess{.stage = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, .access = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT},
       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
       image.vkImageLayout_,
       range);
 
-  ctx_.immediate_->wait(ctx_.immediate_->submit(wrapper2));
+  // 4. Make the copied data available to the host
+  const VkMemoryBarrier2 hostBarrier = {
+      .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+      .srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+      .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+      .dstStageMask = VK_PIPELINE_STAGE_2_HOST_BIT,
+      .dstAccessMask = VK_ACCESS_2_HOST_READ_BIT,
+  };
+  const VkDependencyInfo hostDepInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+      .memoryBarrierCount = 1,
+      .pMemoryBarriers = &hostBarrier,
+  };
+  vkCmdPipelineBarrier2(wrapper.cmdBuf_, &hostDepInfo);
+
+  desc.handle_ = submitCommandBuffer(wrapper);
+
+  return {.handle = desc.handle_, .id = desc.id_, .size = storageSize};
+}
+
+const void* lvk::VulkanStagingDevice::getReadbackData(const ReadbackTicket& ticket) {
+  ReadbackRegionDesc* desc = findReadback(ticket);
+
+  if (!LVK_VERIFY(desc && !desc->isReleased_)) {
+    return nullptr;
+  }
+
+  if (!ctx_.immediate_->isReady(desc->handle_)) {
+    return nullptr;
+  }
+
+  const lvk::VulkanBuffer* buf = ctx_.buffersPool_.get(desc->dedicatedBuffer_.empty() ? readbackBuffer_ : desc->dedicatedBuffer_);
+
+  if (!desc->isInvalidated_ && !buf->isCoherentMemory_) {
+    buf->invalidateMappedMemory(ctx_, desc->offset_, desc->size_);
+  }
+  desc->isInvalidated_ = true;
+
+  return buf->getMappedPtr() + desc->offset_;
+}
+
+void lvk::VulkanStagingDevice::releaseReadback(const ReadbackTicket& ticket) {
+  ReadbackRegionDesc* desc = findReadback(ticket);
+
+  if (!LVK_VERIFY(desc && !desc->isReleased_)) {
+    return;
+  }
+
+  desc->isReleased_ = true;
+
+  retireReadbacks();
+}
+
+lvk::VulkanStagingDevice::ReadbackRegionDesc* lvk::VulkanStagingDevice::findReadback(const ReadbackTicket& ticket) {
+  if (ticket.empty() || readbacks_.empty()) {
+    return nullptr;
+  }
+
+  // tickets are numbered sequentially and retired in order, so the ticket id is an index into `readbacks_` (wraps around naturally)
+  const uint32_t idx = ticket.id - readbacks_.front().id_;
+
+  if (idx >= readbacks_.size()) {
+    return nullptr;
+  }
+
+  ReadbackRegionDesc& desc = readbacks_[idx];
+
+  return desc.handle_.handle() == ticket.handle.handle() ? &desc : nullptr;
+}
+
+void lvk::VulkanStagingDevice::retireReadbacks() {
+  while (!readbacks_.empty() && readbacks_.front().isReleased_ && ctx_.immediate_->isReady(readbacks_.front().handle_)) {
+    const ReadbackRegionDesc& desc = readbacks_.front();
+    if (desc.ringBytes_) {
+      readbackTail_ = desc.offset_ + getAlignedSize(desc.size_, kStagingBufferAlignment);
+      readbackUsed_ -= desc.ringBytes_;
+    }
+    readbacks_.pop_front();
+  }
+
+  if (!readbackUsed_) {
+    // nothing is in flight: rewind to keep the next allocations contiguous
+    readbackHead_ = 0;
+    readbackTail_ = 0;
+  }
+}
+
+lvk::VulkanStagingDevice::ReadbackRegionDesc& lvk::VulkanStagingDevice::allocateReadback(VkDeviceSize size) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT_MSG(size, "Readback size should be non-zero");
+
+  if (readbackBuffer_.empty()) {
+    readbackBufferSize_ = getAlignedSize(
+        std::min<VkDeviceSize>(ctx_.config_.readbackRingSize, ctx_.vkPhysicalDeviceVulkan11Properties_.maxMemoryAllocationSize),
+        kStagingBufferAlignment);
+    readbackBuffer_ = {&ctx_,
+                       ctx_.createBuffer(readbackBufferSize_,
+                                         VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                         nullptr,
+                                         "Buffer: readback ring")};
+    LVK_ASSERT(!readbackBuffer_.empty());
+  }
+
+  retireReadbacks();
+
+  const VkDeviceSize alignedSize = getAlignedSize(size, kStagingBufferAlignment);
+
+  ReadbackRegionDesc desc = {
+      .id_ = readbackCounter_++,
+      .size_ = size,
+  };
+
+  // the ring occupies [tail, head) with a possible wrap-around at the end of the buffer
+  if (!readbackUsed_ || readbackHead_ > readbackTail_) {
+    // free space is [head, end) followed by [0, tail)
+    if (readbackBufferSize_ - readbackHead_ >= alignedSize) {
+      desc.offset_ = readbackHead_;
+      desc.ringBytes_ = alignedSize;
+    } else if (readbackTail_ >= alignedSize) {
+      desc.offset_ = 0;
+      desc.ringBytes_ = readbackBufferSize_ - readbackHead_ + alignedSize;
+    }
+  } else if (readbackHead_ < readbackTail_ && readbackTail_ - readbackHead_ >= alignedSize) {
+    // free space is [head, tail)
+    desc.offset_ = readbackHead_;
+    desc.ringBytes_ = alignedSize;
+  }
+
+  if (desc.ringBytes_) {
+    readbackHead_ = desc.offset_ + alignedSize;
+    readbackUsed_ += desc.ringBytes_;
+  } else {
+    // the ring is full of unreleased or pending readbacks (or the readback is larger than the ring): do not stall
+    char debugName[256] = {0};
+    (void)snprintf(debugName, sizeof(debugName) - 1, "Buffer: dedicated readback buffer %u", desc.id_);
+    desc.dedicatedBuffer_ = {&ctx_,
+                             ctx_.createBuffer(alignedSize,
+                                               VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                               nullptr,
+                                               debugName)};
+    LVK_ASSERT(!desc.dedicatedBuffer_.empty());
+  }
+
+  readbacks_.push_back(std::move(desc));
+
+  return readbacks_.back();
+}
+
+lvk::StagingReservation lvk::VulkanStagingDevice::reserve(size_t size, Result* outResult) {
+  LVK_PROFILER_FUNCTION();
+
+  if (!LVK_VERIFY(size)) {
+    Result::setResult(outResult, Result::Code::ArgumentOutOfRange, "Reservation size should be non-zero");
+    return {};
+  }
+
+  if (reservationBuffer_.empty()) {
+    Result::setResult(outResult, Result::Code::RuntimeError, "Staging reservations are disabled, see ContextConfig");
+    return {};
+  }
+
+  const VkDeviceSize alignedSize = getAlignedSize(size, kStagingBufferAlignment);
+
+  std::lock_guard lock(reservationsMutex_);
+
+  ReservationDesc desc = {
+      .size_ = size,
+  };
+
+  // the ring occupies [tail, head) with a possible wrap-around at the end of the buffer
+  if (!reservationUsed_ || reservationHead_ > reservationTail_) {
+    // free space is [head, end) followed by [0, tail)
+    if (reservationBufferSize_ - reservationHead_ >= alignedSize) {
+      desc.offset_ = reservationHead_;
+      desc.ringBytes_ = alignedSize;
+    } else if (reservationTail_ >= alignedSize) {
+      desc.offset_ = 0;
+      desc.ringBytes_ = reservationBufferSize_ - reservationHead_ + alignedSize;
+    }
+  } else if (reservationHead_ < reservationTail_ && reservationTail_ - reservationHead_ >= alignedSize) {
+    // free space is [head, tail)
+    desc.offset_ = reservationHead_;
+    desc.ringBytes_ = alignedSize;
+  }
+
+  if (!desc.ringBytes_) {
+    // do not stall a worker thread: the caller falls back to a regular upload
+    Result::setResult(outResult, Result::Code::RuntimeError, "The staging reservation ring is full");
+    return {};
+  }
+
+  desc.id_ = reservationCounter_++;
+  reservationHead_ = desc.offset_ + alignedSize;
+  reservationUsed_ += desc.ringBytes_;
+  reservations_.push_back(desc);
+
+  Result::setResult(outResult, Result());
+
+  return {.data = reservationMappedPtr_ + desc.offset_, .size = size, .id = desc.id_};
+}
+
+void lvk::VulkanStagingDevice::cancelReservation(const StagingReservation& reservation) {
+  std::lock_guard lock(reservationsMutex_);
+
+  ReservationDesc* desc = findReservation(reservation);
+
+  if (!LVK_VERIFY(desc && !desc->isConsumed_)) {
+    return;
+  }
+
+  // can be called from any thread, so it is retired later by the render thread
+  desc->isConsumed_ = true;
+}
+
+void lvk::VulkanStagingDevice::bufferSubData(VulkanBuffer& buffer, size_t dstOffset, const StagingReservation& reservation) {
+  LVK_PROFILER_FUNCTION();
+
+  ReservationDesc* desc = nullptr;
+  {
+    // claim the reservation in the same critical section, so a concurrent cancelReservation() either wins or fails
+    std::lock_guard lock(reservationsMutex_);
+    desc = findReservation(reservation);
+    if (!LVK_VERIFY(desc && !desc->isConsumed_)) {
+      return;
+    }
+    desc->isConsumed_ = true;
+  }
+
+  // the pointer stays valid and the reservation cannot be retired before `handle_` is set: only the render thread retires them
+
+  SubmitHandle handle;
+
+  if (buffer.isMapped()) {
+    buffer.bufferSubData(ctx_, dstOffset, reservation.size, reservation.data);
+  } else {
+    lvk::VulkanBuffer* reservationBuffer = ctx_.buffersPool_.get(reservationBuffer_);
+
+    if (!reservationBuffer->isCoherentMemory_) {
+      reservationBuffer->flushMappedMemory(ctx_, desc->offset_, desc->size_);
+    }
+
+    const VkBufferCopy copy = {
+        .srcOffset = desc->offset_,
+        .dstOffset = dstOffset,
+        .size = desc->size_,
+    };
+
+    const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = acquireCommandBuffer();
+    vkCmdCopyBuffer(wrapper.cmdBuf_, reservationBuffer->vkBuffer_, buffer.vkBuffer_, 1, &copy);
+    const VkBufferMemoryBarrier2 barrier = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+        .srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT,
+        .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+        .dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        .dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .buffer = buffer.vkBuffer_,
+        .offset = dstOffset,
+        .size = desc->size_,
+    };
+    const VkDependencyInfo depInfo = {
+        .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+        .bufferMemoryBarrierCount = 1,
+        .pBufferMemoryBarriers = &barrier,
+    };
+    vkCmdPipelineBarrier2(wrapper.cmdBuf_, &depInfo);
+    handle = submitCommandBuffer(wrapper);
+    addStagedChunk(desc->size_);
+  }
+
+  std::lock_guard lock(reservationsMutex_);
+  desc->handle_ = handle;
+}
+
+void lvk::VulkanStagingDevice::imageData2D(VulkanImage& image,
+                                           const VkRect2D& imageRegion,
+                                           uint32_t baseMipLevel,
+                                           uint32_t numMipLevels,
+                                           uint32_t baseLayer,
+                                           uint32_t numLayers,
+                                           VkFormat format,
+                                           const StagingReservation& reservation) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT(numMipLevels <= LVK_MAX_MIP_LEVELS);
+
+  const uint32_t width = image.vkExtent_.width >> baseMipLevel;
+  const uint32_t height = image.vkExtent_.height >> baseMipLevel;
+  const bool coversFullImage = !imageRegion.offset.x && !imageRegion.offset.y && imageRegion.extent.width == width &&
+                               imageRegion.extent.height == height;
+
+  LVK_ASSERT(coversFullImage || image.vkImageLayout_ != VK_IMAGE_LAYOUT_UNDEFINED);
+
+  if (numMipLevels > 1 || numLayers > 1) {
+    LVK_ASSERT_MSG(coversFullImage, "Uploading mip-levels with an image region that is smaller than the base mip-level is not supported");
+  }
+
+  ReservationDesc* desc = nullptr;
+  {
+    // claim the reservation in the same critical section, so a concurrent cancelReservation() either wins or fails
+    std::lock_guard lock(reservationsMutex_);
+    desc = findReservation(reservation);
+    if (!LVK_VERIFY(desc && !desc->isConsumed_)) {
+      return;
+    }
+    desc->isConsumed_ = true;
+  }
+
+  // the pointer stays valid and the reservation cannot be retired before `handle_` is set: only the render thread retires them
+
+  const uint64_t storageSize =
+      getImageStorageSize2D(imageRegion.extent.width, imageRegion.extent.height, vkFormatToFormat(format), numMipLevels, numLayers);
+
+  LVK_ASSERT_MSG(storageSize <= desc->size_, "The staging reservation is too small for this image range");
+
+  lvk::VulkanBuffer* reservationBuffer = ctx_.buffersPool_.get(reservationBuffer_);
+
+  if (!reservationBuffer->isCoherentMemory_) {
+    reservationBuffer->flushMappedMemory(ctx_, desc->offset_, desc->size_);
+  }
+
+  const bool isFirstUpload = coversFullImage && image.vkImageLayout_ == VK_IMAGE_LAYOUT_UNDEFINED;
+  const bool useTransferQueue =
+      isFirstUpload && ctx_.immediateTransfer_ && hasAlignedImageRegions2D(imageRegion, baseMipLevel, numMipLevels, numLayers, format);
+
+  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = acquireCommandBuffer(useTransferQueue);
+
+  recordImageData2D(wrapper,
+                    image,
+                    imageRegion,
+                    baseMipLevel,
+                    numMipLevels,
+                    baseLayer,
+                    numLayers,
+                    format,
+                    reservationBuffer->vkBuffer_,
+                    desc->offset_,
+                    0,
+                    useTransferQueue);
+
+  const SubmitHandle handle = submitCommandBuffer(wrapper);
+  addStagedChunk(storageSize);
+
+  std::lock_guard lock(reservationsMutex_);
+  desc->handle_ = handle;
+}
+
+void lvk::VulkanStagingDevice::retireReservations() {
+  std::lock_guard lock(reservationsMutex_);
+
+  while (!reservations_.empty() && reservations_.front().isConsumed_) {
+    const ReservationDesc& desc = reservations_.front();
+    if (!desc.handle_.empty() && !getImmediateCommands(desc.handle_).isReady(desc.handle_)) {
+      break;
+    }
+    reservationTail_ = desc.offset_ + getAlignedSize(desc.size_, kStagingBufferAlignment);
+    reservationUsed_ -= desc.ringBytes_;
+    reservations_.pop_front();
+  }
+
+  if (!reservationUsed_) {
+    // nothing is reserved: rewind to keep the next reservations contiguous
+    reservationHead_ = 0;
+    reservationTail_ = 0;
+  }
+}
+
+lvk::VulkanStagingDevice::ReservationDesc* lvk::VulkanStagingDevice::findReservation(const StagingReservation& reservation) {
+  if (reservation.empty() || reservations_.empty()) {
+    return nullptr;
+  }
+
+  // reservations are numbered sequentially and retired in order, so the id is an index into `reservations_` (wraps around naturally)
+  const uint32_t idx = reservation.id - reservations_.front().id_;
+
+  if (idx >= reservations_.size()) {
+    return nullptr;
+  }
+
+  ReservationDesc& desc = reservations_[idx];
+
+  return reservationMappedPtr_ + desc.offset_ == reservation.data ? &desc : nullptr;
 }
 
 void lvk::VulkanStagingDevice::ensureStagingBufferSize(VkDeviceSize sizeNeeded) {
   LVK_PROFILER_FUNCTION();
 
   const VkDeviceSize alignedSize = std::max(getAlignedSize(sizeNeeded, kStagingBufferAlignment), minBufferSize_);
+  // round down, so that getNextFreeOffset() never hands out less than an aligned request when the whole ring is used
+  const VkDeviceSize maxSize = ctx_.config_.maxStagingBufferSize - ctx_.config_.maxStagingBufferSize % kStagingBufferAlignment;
 
-  sizeNeeded = alignedSize < ctx_.config_.maxStagingBufferSize ? alignedSize : ctx_.config_.maxStagingBufferSize;
+  sizeNeeded = alignedSize < maxSize ? alignedSize : maxSize;
 
   if (!stagingBuffer_.empty()) {
     const bool isEnoughSize = sizeNeeded <= stagingBufferSize_;
-    const bool isMaxSize = stagingBufferSize_ == ctx_.config_.maxStagingBufferSize;
+    const bool isMaxSize = stagingBufferSize_ == maxSize;
 
     if (isEnoughSize || isMaxSize) {
       return;
     }
   }
 
+  if (!stagingBuffer_.empty()) {
+    stats_.numReallocations++;
+  }
+
   waitAndReset();
 
   // deallocate the previous staging buffer
@@ -4255,118 +5846,360 @@ void lvk::VulkanStagingDevice::ensureStagingBufferSize(VkDeviceSize sizeNeeded)
                                       debugName)};
   LVK_ASSERT(!stagingBuffer_.empty());
 
-  regions_.clear();
-  regions_.push_back({0, stagingBufferSize_, SubmitHandle()});
+  stats_.stagingBufferSize = stagingBufferSize_;
+  stats_.peakStagingBufferSize = std::max<uint64_t>(stats_.peakStagingBufferSize, stagingBufferSize_);
+
+  inFlight_.clear();
+  head_ = 0;
+}
+
+void lvk::VulkanStagingDevice::insertRegion(const MemoryRegionDesc& region) {
+  LVK_ASSERT(!region.handle_.empty());
+
+  // regions are allocated in submission order, so the FIFO stays sorted by completion
+  inFlight_.push_back(region);
+}
+
+void lvk::VulkanStagingDevice::retireRegions() {
+  // only the oldest region is queried: everything behind it was submitted later. With a transfer queue the regions may complete out of
+  // order across the two queues, so this is conservative: a finished region waits behind an older one still running on the other queue
+  while (!inFlight_.empty() && getImmediateCommands(inFlight_.front().handle_).isReady(inFlight_.front().handle_)) {
+    inFlight_.pop_front();
+  }
+}
+
+lvk::VulkanStagingDevice::MemoryRegionDesc lvk::VulkanStagingDevice::getNextFreeOffset(VkDeviceSize size) {
+  LVK_PROFILER_FUNCTION();
+
+  const VkDeviceSize requestedAlignedSize = getAlignedSize(size, kStagingBufferAlignment);
+
+  ensureStagingBufferSize(requestedAlignedSize);
+
+  // a request larger than the entire ring gets the entire ring, and the caller uploads it in multiple chunks
+  const VkDeviceSize allocSize = std::min(requestedAlignedSize, stagingBufferSize_);
+
+  retireRegions();
+
+  for (;;) {
+    if (inFlight_.empty()) {
+      // nothing is in flight: rewind to keep the next allocations contiguous
+      head_ = 0;
+    }
+
+    // the in-flight regions occupy [tail, head_) with a possible wrap-around at the end of the buffer
+    const VkDeviceSize tail = inFlight_.empty() ? 0 : inFlight_.front().offset_;
+
+    VkDeviceSize offset = stagingBufferSize_; // invalid
+
+    if (inFlight_.empty() || head_ > tail) {
+      // free space is [head_, end) followed by [0, tail)
+      if (stagingBufferSize_ - head_ >= allocSize) {
+        offset = head_;
+      } else if (tail >= allocSize) {
+        offset = 0; // wrap around and skip the unused bytes at the end of the buffer
+      }
+    } else if (head_ < tail && tail - head_ >= allocSize) {
+      // free space is [head_, tail)
+      offset = head_;
+    }
+
+    if (offset != stagingBufferSize_) {
+      head_ = offset + allocSize;
+      return {offset, allocSize, SubmitHandle()};
+    }
+
+    // the ring is full: stall on the oldest in-flight region
+    LVK_PROFILER_ZONE("Waiting for staging buffer...", LVK_PROFILER_COLOR_WAIT);
+    const auto waitStartTime = std::chrono::steady_clock::now();
+    const uint64_t oldest = inFlight_.front().handle_.handle();
+    if ((batchWrapper_ && oldest == batchWrapper_->handle_.handle()) ||
+        (batchWrapperTransfer_ && oldest == batchWrapperTransfer_->handle_.handle())) {
+      // the ring is filled by the current batch itself
+      flushBatch();
+    }
+    getImmediateCommands(inFlight_.front().handle_).wait(inFlight_.front().handle_);
+    inFlight_.pop_front();
+    retireRegions();
+    addForcedWait(waitStartTime);
+    LVK_PROFILER_ZONE_END();
+  }
+}
+
+void lvk::VulkanStagingDevice::waitAndReset() {
+  LVK_PROFILER_FUNCTION_COLOR(LVK_PROFILER_COLOR_WAIT);
+
+  const auto waitStartTime = std::chrono::steady_clock::now();
+
+  flushBatch();
+  flushPendingAcquires();
+
+  bool hasWaited = false;
+  for (const MemoryRegionDesc& r : inFlight_) {
+    VulkanImmediateCommands& immediate = getImmediateCommands(r.handle_);
+    // regions which have already completed do not count as a forced wait
+    if (!immediate.isReady(r.handle_)) {
+      immediate.wait(r.handle_);
+      hasWaited = true;
+    }
+  };
+
+  if (hasWaited) {
+    addForcedWait(waitStartTime);
+  }
+
+  inFlight_.clear();
+  head_ = 0;
+}
+
+void lvk::VulkanStagingDevice::addStagedChunk(VkDeviceSize size) {
+  stats_.bytesStaged += size;
+  stats_.numChunks++;
+}
+
+void lvk::VulkanStagingDevice::addForcedWait(std::chrono::steady_clock::time_point startTime) {
+  stats_.numForcedWaits++;
+  stats_.forcedWaitTimeMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
 }
 
-void lvk::VulkanStagingDevice::insertRegion(const MemoryRegionDesc& region) {
-  // keep regions_ sorted by offset so adjacent free regions can be merged
-  auto it = regions_.begin();
-  while (it != regions_.end() && it->offset_ < region.offset_) {
-    ++it;
+void lvk::VulkanStagingDevice::plotStats() {
+  LVK_PROFILER_PLOT("LVK staging: bytes staged", (int64_t)(stats_.bytesStaged - lastPlottedStats_.bytesStaged));
+  LVK_PROFILER_PLOT("LVK staging: chunks", (int64_t)(stats_.numChunks - lastPlottedStats_.numChunks));
+  LVK_PROFILER_PLOT("LVK staging: forced waits", (int64_t)(stats_.numForcedWaits - lastPlottedStats_.numForcedWaits));
+  LVK_PROFILER_PLOT("LVK staging: forced waits (ms)", stats_.forcedWaitTimeMs - lastPlottedStats_.forcedWaitTimeMs);
+  LVK_PROFILER_PLOT("LVK staging: buffer size", (int64_t)stats_.stagingBufferSize);
+  LVK_PROFILER_PLOT("LVK staging: peak buffer size", (int64_t)stats_.peakStagingBufferSize);
+  LVK_PROFILER_PLOT("LVK staging: reallocations", (int64_t)(stats_.numReallocations - lastPlottedStats_.numReallocations));
+
+  lastPlottedStats_ = stats_;
+}
+
+void lvk::VulkanStagingDevice::beginBatch() {
+  LVK_ASSERT_MSG(!isBatching_, "Upload batches cannot be nested");
+
+  isBatching_ = true;
+  hasBatchSubmits_ = false;
+}
+
+lvk::SubmitHandle lvk::VulkanStagingDevice::endBatch() {
+  LVK_PROFILER_FUNCTION();
+
+  isBatching_ = false;
+
+  flushBatch();
+  flushPendingAcquires();
+
+  // the resources become usable on the graphics queue only after the acquire barriers, which are always submitted last
+  const SubmitHandle handle = hasBatchSubmits_ ? ctx_.immediate_->getLastSubmitHandle() : SubmitHandle();
+
+  hasBatchSubmits_ = false;
+
+  return handle;
+}
+
+void lvk::VulkanStagingDevice::flushBatch() {
+  if (batchWrapperTransfer_) {
+    ctx_.immediateTransfer_->submit(*std::exchange(batchWrapperTransfer_, nullptr));
+    hasBatchSubmits_ = true;
+  }
+
+  if (batchWrapper_) {
+    // the acquires go first: the graphics batch can reuse buffers uploaded on the transfer queue earlier
+    const VulkanImmediateCommands::CommandBufferWrapper& wrapper = *std::exchange(batchWrapper_, nullptr);
+    flushPendingAcquires();
+    ctx_.immediate_->submit(wrapper);
+    hasBatchSubmits_ = true;
+  }
+}
+
+void lvk::VulkanStagingDevice::flushPendingAcquires() {
+  if (pendingBufferAcquires_.empty() && pendingImageAcquires_.empty()) {
+    return;
+  }
+
+  LVK_PROFILER_FUNCTION();
+
+  // the releases could still sit in an unsubmitted transfer batch
+  if (batchWrapperTransfer_) {
+    ctx_.immediateTransfer_->submit(*std::exchange(batchWrapperTransfer_, nullptr));
+    hasBatchSubmits_ = true;
+  }
+
+  const VulkanImmediateCommands::CommandBufferWrapper& wrapper = ctx_.immediate_->acquire();
+
+  const VkDependencyInfo depInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+      .bufferMemoryBarrierCount = (uint32_t)pendingBufferAcquires_.size(),
+      .pBufferMemoryBarriers = pendingBufferAcquires_.data(),
+      .imageMemoryBarrierCount = (uint32_t)pendingImageAcquires_.size(),
+      .pImageMemoryBarriers = pendingImageAcquires_.data(),
+  };
+  vkCmdPipelineBarrier2(wrapper.cmdBuf_, &depInfo);
+
+  // 0 if the releasing submit has already been recycled, i.e. it is complete
+  const uint64_t waitValue = ctx_.immediateTransfer_->getTimelineValue(pendingAcquiresHandle_);
+  if (waitValue) {
+    ctx_.immediate_->waitTimelineSemaphore(ctx_.immediateTransfer_->getTimelineSemaphore(), waitValue);
   }
-  regions_.insert(it, region);
-}
 
-lvk::VulkanStagingDevice::MemoryRegionDesc lvk::VulkanStagingDevice::getNextFreeOffset(VkDeviceSize size) {
-  LVK_PROFILER_FUNCTION();
+  ctx_.immediate_->submit(wrapper);
 
-  const VkDeviceSize requestedAlignedSize = getAlignedSize(size, kStagingBufferAlignment);
+  pendingBufferAcquires_.clear();
+  pendingImageAcquires_.clear();
+  pendingAcquiresHandle_ = {};
+}
 
-  ensureStagingBufferSize(requestedAlignedSize);
+const lvk::VulkanImmediateCommands::CommandBufferWrapper& lvk::VulkanStagingDevice::acquireCommandBuffer(bool useTransferQueue) {
+  LVK_ASSERT(!useTransferQueue || ctx_.immediateTransfer_);
 
-  LVK_ASSERT(!regions_.empty());
-
-  // `regions_` is kept sorted by offset, so one forward pass merges adjacent free (ready) regions.
-  // Each region's readiness is queried only once: `next` becomes the following `cur`, so its result is cached in `curReady`
-  if (regions_.size() > 1) {
-    size_t write = 0;
-    bool curReady = ctx_.immediate_->isReady(regions_[0].handle_);
-    for (size_t read = 1; read < regions_.size(); ++read) {
-      MemoryRegionDesc& cur = regions_[write];
-      const MemoryRegionDesc& next = regions_[read];
-      const bool nextReady = ctx_.immediate_->isReady(next.handle_);
-      if (curReady && nextReady && cur.offset_ + cur.size_ == next.offset_) {
-        cur.size_ += next.size_;
-        cur.handle_ = SubmitHandle(); // the merged region is free, so `curReady` stays true
-      } else {
-        regions_[++write] = next;
-        curReady = nextReady;
-      }
-    }
-    regions_.resize(write + 1);
+  lvk::VulkanImmediateCommands& immediate = useTransferQueue ? *ctx_.immediateTransfer_ : *ctx_.immediate_;
+
+  if (!isBatching_) {
+    return immediate.acquire();
   }
 
-  // if we can't find an available region that is big enough to store requestedAlignedSize, return whatever we could find, which will be
-  // stored in bestNextIt
-  auto bestNextIt = regions_.end();
+  const VulkanImmediateCommands::CommandBufferWrapper*& batchWrapper = useTransferQueue ? batchWrapperTransfer_ : batchWrapper_;
 
-  for (auto it = regions_.begin(); it != regions_.end(); ++it) {
-    if (ctx_.immediate_->isReady(it->handle_)) {
-      // This region is free, but is it big enough?
-      if (it->size_ >= requestedAlignedSize) {
-        // It is big enough!
-        const VkDeviceSize unusedSize = it->size_ - requestedAlignedSize;
-        const VkDeviceSize unusedOffset = it->offset_ + requestedAlignedSize;
+  if (!batchWrapper) {
+    batchWrapper = &immediate.acquire();
+  }
 
-        // Return this region and add the remaining unused size to the regions_ vector
-        SCOPE_EXIT {
-          regions_.erase(it);
-          if (unusedSize > 0) {
-            insertRegion({unusedOffset, unusedSize, SubmitHandle()});
-          }
-        };
+  return *batchWrapper;
+}
 
-        return {it->offset_, requestedAlignedSize, SubmitHandle()};
-      }
-      // cache the largest available region that isn't as big as the one we're looking for
-      if (bestNextIt == regions_.end() || it->size_ > bestNextIt->size_) {
-        bestNextIt = it;
-      }
-    }
+lvk::SubmitHandle lvk::VulkanStagingDevice::submitCommandBuffer(const VulkanImmediateCommands::CommandBufferWrapper& wrapper) {
+  if (&wrapper == batchWrapper_ || &wrapper == batchWrapperTransfer_) {
+    // the actual submit is deferred until flushBatch(), but the handle is already known and stays the same
+    return wrapper.handle_;
   }
 
-  // we found a region that is available that is smaller than the requested size. It's the best we can do
-  if (bestNextIt != regions_.end() && ctx_.immediate_->isReady(bestNextIt->handle_)) {
-    SCOPE_EXIT {
-      regions_.erase(bestNextIt);
-    };
-
-    return {bestNextIt->offset_, bestNextIt->size_, SubmitHandle()};
+  if (isTransferQueue(wrapper)) {
+    return ctx_.immediateTransfer_->submit(wrapper);
   }
 
-  // nothing was available. Let's wait for the entire staging buffer to become free
-  waitAndReset();
+  // a graphics copy may touch a resource released by the transfer queue
+  flushPendingAcquires();
+
+  return ctx_.immediate_->submit(wrapper);
+}
 
-  // waitAndReset() adds a region that spans the entire buffer. Since we'll be using part of it, we need to replace it with a used block and
-  // an unused portion
-  regions_.clear();
+lvk::VulkanImmediateCommands& lvk::VulkanStagingDevice::getImmediateCommands(SubmitHandle handle) const {
+  const bool isTransfer =
+      ctx_.immediateTransfer_ && !handle.empty() && handle.queueFamilyIndex_ == ctx_.deviceQueues_.transferQueueFamilyIndex;
 
-  // store the unused size in the vector first...
-  const uint64_t unusedSize = stagingBufferSize_ > requestedAlignedSize ? stagingBufferSize_ - requestedAlignedSize : 0;
+  return isTransfer ? *ctx_.immediateTransfer_ : *ctx_.immediate_;
+}
 
-  if (unusedSize) {
-    const uint64_t unusedOffset = stagingBufferSize_ - unusedSize;
-    regions_.insert(regions_.begin(), {unusedOffset, unusedSize, SubmitHandle()});
-  }
+bool lvk::VulkanStagingDevice::isTransferQueue(const VulkanImmediateCommands::CommandBufferWrapper& wrapper) const {
+  return ctx_.immediateTransfer_ && wrapper.handle_.queueFamilyIndex_ == ctx_.deviceQueues_.transferQueueFamilyIndex;
+}
 
-  // ...and then return the smallest free region that can hold the requested size
-  return {
-      .offset_ = 0,
-      .size_ = stagingBufferSize_ - unusedSize,
-      .handle_ = SubmitHandle(),
+void lvk::VulkanStagingDevice::releaseBufferOwnership(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                                                      VkBuffer buffer,
+                                                      VkDeviceSize offset,
+                                                      VkDeviceSize size) {
+  LVK_ASSERT(isTransferQueue(wrapper));
+
+  const uint32_t srcQueueFamily = ctx_.deviceQueues_.transferQueueFamilyIndex;
+  const uint32_t dstQueueFamily = ctx_.deviceQueues_.graphicsQueueFamilyIndex;
+
+  // the destination access scope of a release barrier is ignored
+  const VkBufferMemoryBarrier2 release = {
+      .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+      .srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT,
+      .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+      .dstStageMask = VK_PIPELINE_STAGE_2_NONE,
+      .dstAccessMask = VK_ACCESS_2_NONE,
+      .srcQueueFamilyIndex = srcQueueFamily,
+      .dstQueueFamilyIndex = dstQueueFamily,
+      .buffer = buffer,
+      .offset = offset,
+      .size = size,
+  };
+  const VkDependencyInfo depInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+      .bufferMemoryBarrierCount = 1,
+      .pBufferMemoryBarriers = &release,
   };
+  vkCmdPipelineBarrier2(wrapper.cmdBuf_, &depInfo);
+
+  // the source access scope of an acquire barrier is ignored; the source stage chains it to the timeline semaphore wait (ALL_COMMANDS)
+  pendingBufferAcquires_.push_back(VkBufferMemoryBarrier2{
+      .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+      .srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+      .srcAccessMask = VK_ACCESS_2_NONE,
+      .dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+      .dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT,
+      .srcQueueFamilyIndex = srcQueueFamily,
+      .dstQueueFamilyIndex = dstQueueFamily,
+      .buffer = buffer,
+      .offset = offset,
+      .size = size,
+  });
+  pendingAcquiresHandle_ = wrapper.handle_;
 }
 
-void lvk::VulkanStagingDevice::waitAndReset() {
-  LVK_PROFILER_FUNCTION_COLOR(LVK_PROFILER_COLOR_WAIT);
+void lvk::VulkanStagingDevice::releaseImageOwnership(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                                                     VkImage image,
+                                                     VkImageLayout oldLayout,
+                                                     VkImageLayout newLayout,
+                                                     const VkImageSubresourceRange& range) {
+  LVK_ASSERT(isTransferQueue(wrapper));
 
-  for (const MemoryRegionDesc& r : regions_) {
-    ctx_.immediate_->wait(r.handle_);
+  const uint32_t srcQueueFamily = ctx_.deviceQueues_.transferQueueFamilyIndex;
+  const uint32_t dstQueueFamily = ctx_.deviceQueues_.graphicsQueueFamilyIndex;
+
+  // the layout transition is specified identically in both halves and happens only once
+  const VkImageMemoryBarrier2 release = {
+      .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+      .srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+      .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+      .dstStageMask = VK_PIPELINE_STAGE_2_NONE,
+      .dstAccessMask = VK_ACCESS_2_NONE,
+      .oldLayout = oldLayout,
+      .newLayout = newLayout,
+      .srcQueueFamilyIndex = srcQueueFamily,
+      .dstQueueFamilyIndex = dstQueueFamily,
+      .image = image,
+      .subresourceRange = range,
+  };
+  const VkDependencyInfo depInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+      .imageMemoryBarrierCount = 1,
+      .pImageMemoryBarriers = &release,
   };
+  vkCmdPipelineBarrier2(wrapper.cmdBuf_, &depInfo);
+
+  pendingImageAcquires_.push_back(VkImageMemoryBarrier2{
+      .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+      .srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+      .srcAccessMask = VK_ACCESS_2_NONE,
+      .dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+      .dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT,
+      .oldLayout = oldLayout,
+      .newLayout = newLayout,
+      .srcQueueFamilyIndex = srcQueueFamily,
+      .dstQueueFamilyIndex = dstQueueFamily,
+      .image = image,
+      .subresourceRange = range,
+  });
+  pendingAcquiresHandle_ = wrapper.handle_;
+}
+
+lvk::Holder<lvk::BufferHandle> lvk::VulkanStagingDevice::createOversizeStagingBuffer(VkDeviceSize size) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT(size <= ctx_.vkPhysicalDeviceVulkan11Properties_.maxMemoryAllocationSize);
 
-  regions_.clear();
-  regions_.push_back({0, stagingBufferSize_, SubmitHandle()});
+  char debugName[256] = {0};
+  (void)snprintf(debugName, sizeof(debugName) - 1, "Buffer: oversize staging buffer %u", stagingBufferCounter_++);
+
+  // the caller drops the holder right after submitting its copy: the deferred destruction is keyed on that same submit handle
+  return {&ctx_,
+          ctx_.createBuffer(getAlignedSize(size, kStagingBufferAlignment),
+                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                            nullptr,
+                            debugName)};
 }
 
 lvk::VulkanContext::VulkanContext(const lvk::ContextConfig& config, void* window, void* display, VkSurfaceKHR surface)
@@ -4402,6 +6235,25 @@ lvk::VulkanContext::VulkanContext(const lvk::ContextConfig& config, void* window
 lvk::VulkanContext::~VulkanContext() {
   LVK_PROFILER_FUNCTION();
 
+  if (stagingDevice_) {
+    // submit an upload batch left open by the app
+    stagingDevice_->endBatch();
+  }
+
+  // the pipeline compilation threads finish their queue before exiting
+  {
+    std::lock_guard lock(pimpl_->pipelineCompileMutex_);
+    pimpl_->pipelineCompileExit_ = true;
+  }
+  pimpl_->pipelineCompileCondition_.notify_all();
+  for (std::thread& t : pimpl_->pipelineCompileThreads_) {
+    t.join();
+  }
+  pimpl_->pipelineCompileThreads_.clear();
+  if (pimpl_->pipelineCacheSaveDone_.valid()) {
+    pimpl_->pipelineCacheSaveDone_.wait();
+  }
+
   VK_ASSERT(vkDeviceWaitIdle(vkDevice_));
 
 #if defined(LVK_WITH_TRACY_GPU)
@@ -4412,12 +6264,23 @@ lvk::VulkanContext::~VulkanContext() {
 #endif // LVK_WITH_TRACY_GPU
 
   stagingDevice_.reset(nullptr);
+  if (commandListsPool_.numObjects()) {
+    LLOGW("Leaked %u command lists\n", commandListsPool_.numObjects());
+  }
+  commandListsPool_.clear();
+  // stale command list recordings are freed by deferred tasks into the command pool of `secondaryCommands_`
+  waitDeferredTasks();
+  secondaryCommands_.reset(nullptr);
   swapchain_.reset(nullptr); // swapchain has to be destroyed prior to Surface
 
   vkDestroySemaphore(vkDevice_, timelineSemaphore_, nullptr);
 
   destroy(dummyTexture_);
 
+  for (const DescriptorSet& dset : DSets_) {
+    destroy(dset.descriptorBuffer);
+  }
+
   for (VulkanContextImpl::YcbcrConversionData& data : pimpl_->ycbcrConversionData_) {
     if (data.info.conversion != VK_NULL_HANDLE) {
       vkDestroySamplerYcbcrConversion(vkDevice_, data.info.conversion, nullptr);
@@ -4431,6 +6294,9 @@ lvk::VulkanContext::~VulkanContext() {
   if (renderPipelinesPool_.numObjects()) {
     LLOGW("Leaked %u render pipelines\n", renderPipelinesPool_.numObjects());
   }
+  for (lvk::RenderPipelineState& rps : renderPipelinesPool_.objects_) {
+    finishPipelineCompilation(rps);
+  }
   if (computePipelinesPool_.numObjects()) {
     LLOGW("Leaked %u compute pipelines\n", computePipelinesPool_.numObjects());
   }
@@ -4455,15 +6321,21 @@ lvk::VulkanContext::~VulkanContext() {
 
   waitDeferredTasks();
 
+  immediateTransfer_.reset(nullptr);
   immediateCompute_.reset(nullptr);
   immediate_.reset(nullptr);
 
   for (const DescriptorSet& dset : DSets_) {
     vkDestroyDescriptorPool(vkDevice_, dset.vkDPool, nullptr);
-    vkDestroyDescriptorSetLayout(vkDevice_, dset.vkDSL, nullptr);
   }
+  vkDestroyDescriptorSetLayout(vkDevice_, vkDSL_, nullptr);
   vkDestroyDescriptorSetLayout(vkDevice_, dslInputAttachments_, nullptr);
   vkDestroySurfaceKHR(vkInstance_, vkSurface_, nullptr);
+  for (const auto& [hash, library] : pimpl_->pipelineLibraries_) {
+    vkDestroyPipeline(vkDevice_, library.pipeline, nullptr);
+  }
+  pimpl_->pipelineLibraries_.clear();
+  savePipelineCacheFile();
   vkDestroyPipelineCache(vkDevice_, pipelineCache_, nullptr);
 
   // Clean up VMA
@@ -4493,39 +6365,88 @@ lvk::ICommandBuffer& lvk::VulkanContext::acquireCommandBuffer(bool dedicatedComp
   LVK_PROFILER_FUNCTION();
 
   if (dedicatedCompute && !immediateCompute_) {
-    // Fall back to the graphics command buffer when there is no dedicated async-compute queue
-    return pimpl_->currentCommandBuffer_.ctx_ ? pimpl_->currentCommandBuffer_ : acquireCommandBuffer();
+    // Fall back to the graphics queue when there is no dedicated async-compute queue
+    dedicatedCompute = false;
   }
 
-  lvk::CommandBuffer& commandBuffer = dedicatedCompute ? pimpl_->currentComputeCommandBuffer_ : pimpl_->currentCommandBuffer_;
-
-  LVK_ASSERT_MSG(!commandBuffer.ctx_, "Cannot acquire more than 1 command buffer simultaneously");
-
 #if defined(_M_ARM64)
   vkDeviceWaitIdle(vkDevice_); // a temporary workaround for Windows on Snapdragon
 #endif
 
-  commandBuffer = dedicatedCompute ? CommandBuffer(this, *immediateCompute_, deviceQueues_.computeQueueFamilyIndex)
-                                   : CommandBuffer(this, *immediate_, deviceQueues_.graphicsQueueFamilyIndex);
+  CommandBuffer commandBuffer = dedicatedCompute ? CommandBuffer(this, *immediateCompute_, deviceQueues_.computeQueueFamilyIndex)
+                                                 : CommandBuffer(this, *immediate_, deviceQueues_.graphicsQueueFamilyIndex);
+  commandBuffer.acquiredDescriptorSetsGeneration_ = descriptorSetsGeneration_;
+
+  // one slot per command buffer wrapper: several command buffers can be recorded at the same time and submitted together
+  std::deque<lvk::CommandBuffer>& slots = dedicatedCompute ? pimpl_->computeCommandBuffers_ : pimpl_->commandBuffers_;
+  const uint32_t bufferIndex = commandBuffer.wrapper_->handle_.bufferIndex_;
+
+  if (bufferIndex >= slots.size()) {
+    slots.resize(bufferIndex + 1);
+  }
+
+  lvk::CommandBuffer& slot = slots[bufferIndex];
+
+  LVK_ASSERT_MSG(!slot.ctx_, "This command buffer slot is still in use");
+
+  slot = std::move(commandBuffer);
 
-  return commandBuffer;
+  return slot;
 }
 
 lvk::SubmitHandle lvk::VulkanContext::submit(lvk::ICommandBuffer& commandBuffer,
                                              TextureHandle present,
                                              const ldr::Span<TextureHandle>& release) {
+  return submitCommandBuffers({&commandBuffer}, present, release, nullptr);
+}
+
+lvk::SubmitHandle lvk::VulkanContext::submit(const ldr::Span<ICommandBuffer*>& commandBuffers,
+                                             TextureHandle present,
+                                             SubmitHandle* outHandles) {
+  return submitCommandBuffers(commandBuffers, present, {}, outHandles);
+}
+
+lvk::SubmitHandle lvk::VulkanContext::submitCommandBuffers(const ldr::Span<ICommandBuffer*>& commandBuffers,
+                                                           TextureHandle present,
+                                                           const ldr::Span<TextureHandle>& release,
+                                                           SubmitHandle* outHandles) {
   LVK_PROFILER_FUNCTION();
 
-  CommandBuffer* vkCmdBuffer = static_cast<CommandBuffer*>(&commandBuffer);
+  const uint32_t numCommandBuffers = (uint32_t)commandBuffers.size();
+
+  if (!LVK_VERIFY(numCommandBuffers && numCommandBuffers <= VulkanImmediateCommands::kMaxBatchedCommandBuffers)) {
+    return {};
+  }
+
+  // `present`, `release` and the cross-queue waits are recorded into (or applied to) the last command buffer of the batch
+  CommandBuffer* vkCmdBuffer = static_cast<CommandBuffer*>(commandBuffers[numCommandBuffers - 1]);
+
+  const VulkanImmediateCommands::CommandBufferWrapper* wrappers[VulkanImmediateCommands::kMaxBatchedCommandBuffers] = {};
 
-  LVK_ASSERT(vkCmdBuffer);
-  LVK_ASSERT(vkCmdBuffer->ctx_);
-  LVK_ASSERT(vkCmdBuffer->wrapper_);
+  for (uint32_t i = 0; i != numCommandBuffers; i++) {
+    CommandBuffer* cmdBuffer = static_cast<CommandBuffer*>(commandBuffers[i]);
+    LVK_ASSERT(cmdBuffer);
+    LVK_ASSERT(cmdBuffer->ctx_);
+    LVK_ASSERT(cmdBuffer->wrapper_);
+    LVK_ASSERT_MSG(!cmdBuffer->isSecondary_, "Secondary command buffers are submitted via cmdExecuteCommands() of a primary one");
+    LVK_ASSERT_MSG(cmdBuffer->immediate_ == vkCmdBuffer->immediate_,
+                   "All command buffers of one submit should belong to the same queue");
+    wrappers[i] = cmdBuffer->wrapper_;
+    uint64_t& computeWaitValue = vkCmdBuffer->crossQueueComputeWaitValue_;
+    uint64_t& graphicsWaitValue = vkCmdBuffer->crossQueueGraphicsWaitValue_;
+    computeWaitValue = std::max(computeWaitValue, cmdBuffer->crossQueueComputeWaitValue_);
+    graphicsWaitValue = std::max(graphicsWaitValue, cmdBuffer->crossQueueGraphicsWaitValue_);
+  }
 
 #if defined(LVK_WITH_TRACY_GPU)
   TracyVkCollect(pimpl_->tracyVkCtx_, vkCmdBuffer->wrapper_->cmdBuf_);
 #endif // LVK_WITH_TRACY_GPU
 
+  // pending batched uploads go first, so this command buffer can consume them (before any present/timeline signals are set up below)
+  stagingDevice_->flushBatch();
+  // the graphics queue takes the ownership of everything uploaded on the transfer queue (async compute waits on the graphics timeline)
+  stagingDevice_->flushPendingAcquires();
+
   if (present) {
     const lvk::VulkanImage& tex = *texturesPool_.get(present);
 
@@ -4591,15 +6512,42 @@ lvk::SubmitHandle lvk::VulkanContext::submit(lvk::ICommandBuffer& commandBuffer,
     imm.waitTimelineSemaphore(immediateCompute_->getTimelineSemaphore(), vkCmdBuffer->crossQueueComputeWaitValue_);
   }
 
-  vkCmdBuffer->lastSubmitHandle_ = imm.submit(*vkCmdBuffer->wrapper_);
+  const SubmitHandle handle = imm.submit(wrappers, numCommandBuffers);
+
+  for (uint32_t i = 0; i != numCommandBuffers; i++) {
+    CommandBuffer* cmdBuffer = static_cast<CommandBuffer*>(commandBuffers[i]);
+    imm.stats_.numStateCommandsEmitted += cmdBuffer->numStateCommandsEmitted_;
+    imm.stats_.numStateCommandsSkipped += cmdBuffer->numStateCommandsSkipped_;
+    cmdBuffer->lastSubmitHandle_ = cmdBuffer->wrapper_->handle_;
+    if (outHandles) {
+      outHandles[i] = cmdBuffer->lastSubmitHandle_;
+    }
+    if (!cmdBuffer->executedSecondaries_.empty()) {
+      secondaryCommands_->markSubmitted(cmdBuffer->executedSecondaries_, imm.getTimelineValue(handle));
+    }
+  }
 
   if (shouldPresent) {
     swapchain_->present(immediate_->acquireLastSubmitSemaphore());
+    stagingDevice_->plotStats();
+    // one timeline query per queue and frame; isReady() checks against these cached values
+    for (const VulkanImmediateCommands* queue : {immediate_.get(), immediateCompute_.get(), immediateTransfer_.get()}) {
+      if (queue) {
+        queue->updateCompletedTimelineValue();
+      }
+    }
+    // persist new pipelines at most once per ContextConfig::pipelineCacheSavePeriodMs, off the render thread
+    if (!pimpl_->pipelineCacheFileName_.empty() &&
+        VulkanPipelineBuilder::getNumPipelinesCreated() != pimpl_->pipelineCacheNumPipelinesSaved_ &&
+        std::chrono::steady_clock::now() - pimpl_->pipelineCacheSaveTime_ >= std::chrono::milliseconds(config_.pipelineCacheSavePeriodMs)) {
+      savePipelineCacheFile(true);
+    }
   }
 
   processDeferredTasks();
 
-  SubmitHandle handle = vkCmdBuffer->lastSubmitHandle_;
+  // loader threads only reserve staging memory, it is retired here on the render thread
+  stagingDevice_->retireReservations();
 
   // assign the last submit handle to all previous "orphan" dsets
   const size_t numSets = DSets_.size();
@@ -4613,12 +6561,10 @@ lvk::SubmitHandle lvk::VulkanContext::submit(lvk::ICommandBuffer& commandBuffer,
     DSets_[idx].handle_ = handle;
   }
 
-  // Reset the just-submitted slot (graphics or async-compute). Consumers reference a compute submission by SubmitHandle (a value
-  // looked up against the compute queue's timeline), not by a CommandBuffer pointer, so nothing needs this object to outlive submit().
-  if (&imm == immediateCompute_.get()) {
-    pimpl_->currentComputeCommandBuffer_ = {};
-  } else {
-    pimpl_->currentCommandBuffer_ = {};
+  // Reset the just-submitted slots (graphics or async-compute). Consumers reference a compute submission by SubmitHandle (a value
+  // looked up against the compute queue's timeline), not by a CommandBuffer pointer, so nothing needs these objects to outlive submit().
+  for (ICommandBuffer* cmdBuffer : commandBuffers) {
+    *static_cast<CommandBuffer*>(cmdBuffer) = {};
   }
 
   return handle;
@@ -4630,6 +6576,10 @@ void lvk::VulkanContext::wait(SubmitHandle handle) {
     immediateCompute_->wait(handle);
     return;
   }
+  if (immediateTransfer_ && !handle.empty() && handle.queueFamilyIndex_ == deviceQueues_.transferQueueFamilyIndex) {
+    immediateTransfer_->wait(handle);
+    return;
+  }
   immediate_->wait(handle);
 }
 
@@ -4698,7 +6648,8 @@ lvk::Holder<lvk::BufferHandle> lvk::VulkanContext::createBuffer(const BufferDesc
   }
 
   if (desc.data) {
-    upload(handle, desc.data, desc.size, 0);
+    // the initial contents of a new buffer can be uploaded on the transfer queue
+    stagingDevice_->bufferSubData(*buffersPool_.get(handle), 0, desc.size, desc.data, true);
   }
 
   Result::setResult(outResult, Result());
@@ -4767,6 +6718,7 @@ lvk::Holder<lvk::AccelStructHandle> lvk::VulkanContext::createAccelerationStruct
   Result::setResult(outResult, result);
 
   awaitingCreation_ = true;
+  dirtyAccelStructs_ = true;
 
   return {this, handle};
 }
@@ -4950,7 +6902,7 @@ lvk::Holder<lvk::TextureHandle> lvk::VulkanContext::createTexture(const TextureD
   LVK_ASSERT(vkExtent.height > 0);
   LVK_ASSERT(vkExtent.depth > 0);
 
-  // add VK_IMAGE_USAGE_HOST_TRANSFER_BIT to eligible single-plane images to enable the staging-free imageData2D() path
+  // add VK_IMAGE_USAGE_HOST_TRANSFER_BIT to eligible single-plane images to enable the staging-free upload and download paths
   if (desc.storage != lvk::StorageType_Memoryless && lvk::getNumImagePlanes(desc.format) == 1) {
     const VkImageCreateInfo hostCopyProbe = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
@@ -5176,12 +7128,15 @@ lvk::Holder<lvk::TextureHandle> lvk::VulkanContext::createTexture(const TextureD
   TextureHandle handle = texturesPool_.create(std::move(image));
 
   awaitingCreation_ = true;
+  dirtyTextures_.push_back(handle.index());
 
-  if (desc.data) {
+  if (desc.data || !desc.dataStaging.empty()) {
     LVK_ASSERT(desc.type == TextureType_2D || desc.type == TextureType_Cube);
     LVK_ASSERT(desc.dataNumMipLevels <= desc.numMipLevels);
+    LVK_ASSERT_MSG(!desc.data || desc.dataStaging.empty(), "`data` and `dataStaging` are mutually exclusive");
     const uint32_t numLayers = desc.type == TextureType_Cube ? 6 : 1;
-    Result res = upload(handle, {.dimensions = desc.dimensions, .numLayers = numLayers, .numMipLevels = desc.dataNumMipLevels}, desc.data);
+    const TextureRangeDesc range = {.dimensions = desc.dimensions, .numLayers = numLayers, .numMipLevels = desc.dataNumMipLevels};
+    Result res = desc.data ? upload(handle, range, desc.data) : upload(handle, range, desc.dataStaging);
     if (!res.isOk()) {
       Result::setResult(outResult, res);
       return {};
@@ -5291,6 +7246,7 @@ lvk::Holder<lvk::TextureHandle> lvk::VulkanContext::createTextureView(lvk::Textu
   TextureHandle handle = texturesPool_.create(std::move(image));
 
   awaitingCreation_ = true;
+  dirtyTextures_.push_back(handle.index());
 
   return {this, handle};
 }
@@ -5541,9 +7497,15 @@ const VkSamplerYcbcrConversionInfo* lvk::VulkanContext::getOrCreateYcbcrConversi
   return &pimpl_->ycbcrConversionData_[format].info;
 }
 
-VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32_t viewMask) {
+VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32_t viewMask, bool wait) {
+  std::lock_guard lock(pimpl_->renderPipelinesMutex_);
+
   lvk::RenderPipelineState* rps = renderPipelinesPool_.get(handle);
 
+  if (rps && rps->owner_.valid()) {
+    rps = renderPipelinesPool_.get(rps->owner_);
+  }
+
   if (!rps) {
     return VK_NULL_HANDLE;
   }
@@ -5565,24 +7527,50 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32
 
   const DescriptorSet& dset = DSets_[lastUpdatedDSet_];
 
-  if (rps->lastVkDescriptorSetLayout_ != dset.vkDSL || rps->viewMask_ != viewMask) {
-    deferredTask(std::packaged_task<void()>(
-        [device = getVkDevice(), pipeline = rps->pipeline_]() { vkDestroyPipeline(device, pipeline, nullptr); }));
+  if (rps->lastVkDescriptorSetLayout_ != dset.vkDSL) {
+    // pipelines being compiled have to be finished before their layout can be destroyed
+    finishPipelineCompilation(*rps);
+    for (uint32_t i = 0; i != rps->numVariants_; i++) {
+      deferredTask(std::packaged_task<void()>(
+          [device = getVkDevice(), pipeline = rps->variants_[i].pipeline]() { vkDestroyPipeline(device, pipeline, nullptr); }));
+    }
     deferredTask(std::packaged_task<void()>(
         [device = getVkDevice(), layout = rps->pipelineLayout_]() { vkDestroyPipelineLayout(device, layout, nullptr); }));
-    rps->pipeline_ = VK_NULL_HANDLE;
+    rps->numVariants_ = 0;
+    rps->pipelineLayout_ = VK_NULL_HANDLE;
     rps->lastVkDescriptorSetLayout_ = dset.vkDSL;
-    rps->viewMask_ = viewMask;
   }
 
-  if (rps->pipeline_ != VK_NULL_HANDLE) {
-    return rps->pipeline_;
+  RenderPipelineState::Variant* variant = rps->getVariant(viewMask);
+
+  // a fast-linked pipeline is used until its optimized link is ready, nobody waits for that one
+  if (variant && variant->compileJob && (variant->compileJob->isReady() || (wait && variant->pipeline == VK_NULL_HANDLE))) {
+    finishPipelineCompilation(*variant, false);
+  }
+
+  if (variant && (variant->pipeline != VK_NULL_HANDLE || variant->compileJob)) {
+    // VK_NULL_HANDLE while still being compiled in the background
+    return variant->pipeline;
+  }
+
+  if (!variant) {
+    if (rps->numVariants_ == RenderPipelineState::LVK_MAX_PIPELINE_VARIANTS) {
+      RenderPipelineState::Variant& oldest = rps->variants_[0];
+      finishPipelineCompilation(oldest);
+      deferredTask(std::packaged_task<void()>(
+          [device = getVkDevice(), pipeline = oldest.pipeline]() { vkDestroyPipeline(device, pipeline, nullptr); }));
+      std::move(rps->variants_ + 1, rps->variants_ + rps->numVariants_, rps->variants_);
+      rps->numVariants_--;
+    }
+    variant = &rps->variants_[rps->numVariants_++];
+    *variant = {.viewMask = viewMask};
   }
 
   // build a new Vulkan pipeline
 
-  VkPipelineLayout layout = VK_NULL_HANDLE;
-  VkPipeline pipeline = VK_NULL_HANDLE;
+  VkPipelineLayout layout = rps->pipelineLayout_;
+
+  RenderPipelineCompileJob* job = new RenderPipelineCompileJob();
 
   const RenderPipelineDesc& desc = rps->desc_;
 
@@ -5638,20 +7626,43 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32
                desc.patchControlPoints <= vkPhysicalDeviceProperties2_.properties.limits.maxTessellationPatchSize);
   }
 
+  // the job owns copies of everything that lives in pools and can move while the pipeline is being compiled
+  const std::pair<const lvk::ShaderModuleState*, ShaderStage> modules[] = {
+      {vertModule, Stage_Vert},
+      {tescModule, Stage_Tesc},
+      {teseModule, Stage_Tese},
+      {geomModule, Stage_Geom},
+      {fragModule, Stage_Frag},
+      {taskModule, Stage_Task},
+      {meshModule, Stage_Mesh},
+  };
+  for (const auto& [sm, stage] : modules) {
+    if (sm) {
+      job->shaderModules[stage] = sm->ci;
+    }
+  }
+  const VkShaderModuleCreateInfo* ciModules = job->shaderModules;
+
+  memcpy(job->vkBindings, rps->vkBindings_, sizeof(job->vkBindings));
+  memcpy(job->vkAttributes, rps->vkAttributes_, sizeof(job->vkAttributes));
+
   const VkPipelineVertexInputStateCreateInfo ciVertexInputState = {
       .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
       .vertexBindingDescriptionCount = rps->numBindings_,
-      .pVertexBindingDescriptions = rps->numBindings_ ? rps->vkBindings_ : nullptr,
+      .pVertexBindingDescriptions = rps->numBindings_ ? job->vkBindings : nullptr,
       .vertexAttributeDescriptionCount = rps->numAttributes_,
-      .pVertexAttributeDescriptions = rps->numAttributes_ ? rps->vkAttributes_ : nullptr,
+      .pVertexAttributeDescriptions = rps->numAttributes_ ? job->vkAttributes : nullptr,
   };
 
-  VkSpecializationMapEntry entries[SpecializationConstantDesc::LVK_SPECIALIZATION_CONSTANTS_MAX] = {};
-
-  const VkSpecializationInfo si = lvk::getPipelineShaderStageSpecializationInfo(desc.specInfo, entries);
+  job->si = lvk::getPipelineShaderStageSpecializationInfo(desc.specInfo, job->entries);
+  if (job->si.dataSize) {
+    job->specData.assign((const uint8_t*)job->si.pData, (const uint8_t*)job->si.pData + job->si.dataSize);
+    job->si.pData = job->specData.data();
+  }
+  const VkSpecializationInfo* si = &job->si;
 
   // create pipeline layout
-  {
+  if (layout == VK_NULL_HANDLE) {
 #define UPDATE_PUSH_CONSTANT_SIZE(sm, bit)                                  \
   if (sm) {                                                                 \
     pushConstantsSize = std::max(pushConstantsSize, sm->pushConstantsSize); \
@@ -5695,9 +7706,10 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32
       (void)snprintf(pipelineLayoutName, sizeof(pipelineLayoutName) - 1, "Pipeline Layout: %s", rps->desc_.debugName);
     }
     VK_ASSERT(lvk::setDebugObjectName(vkDevice_, VK_OBJECT_TYPE_PIPELINE_LAYOUT, (uint64_t)layout, pipelineLayoutName));
+    rps->pipelineLayout_ = layout;
   }
 
-  lvk::VulkanPipelineBuilder()
+  job->builder
       // from Vulkan 1.0
       .dynamicState(VK_DYNAMIC_STATE_VIEWPORT)
       .dynamicState(VK_DYNAMIC_STATE_SCISSOR)
@@ -5714,6 +7726,8 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32
       .createFlags(VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR, has_KHR_fragment_shading_rate_)
       // from VK_EXT_fragment_density_map
       .createFlags(VK_PIPELINE_CREATE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_BIT_EXT, has_EXT_fragment_density_map_)
+      // from VK_EXT_descriptor_buffer
+      .createFlags(VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT, has_EXT_descriptor_buffer_)
       .primitiveTopology(topologyToVkPrimitiveTopology(desc.topology))
       .rasterizationSamples(getVulkanSampleCountFlags(desc.samplesCount, getFramebufferMSAABitMask()), desc.minSampleShading)
       .alphaToCoverage(desc.alphaToCoverage)
@@ -5731,20 +7745,20 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32
       .stencilMasks(VK_STENCIL_FACE_FRONT_BIT, 0xFF, desc.frontFaceStencil.writeMask, desc.frontFaceStencil.readMask)
       .stencilMasks(VK_STENCIL_FACE_BACK_BIT, 0xFF, desc.backFaceStencil.writeMask, desc.backFaceStencil.readMask)
       .shaderStage(taskModule
-                       ? lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_TASK_BIT_EXT, taskModule->ci, desc.entryPointTask, &si)
+                       ? lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_TASK_BIT_EXT, ciModules[Stage_Task], desc.entryPointTask, si)
                        : VkPipelineShaderStageCreateInfo{.module = VK_NULL_HANDLE})
       .shaderStage(meshModule
-                       ? lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_MESH_BIT_EXT, meshModule->ci, desc.entryPointMesh, &si)
-                       : lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_VERTEX_BIT, vertModule->ci, desc.entryPointVert, &si))
-      .shaderStage(lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_FRAGMENT_BIT, fragModule->ci, desc.entryPointFrag, &si))
+                       ? lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_MESH_BIT_EXT, ciModules[Stage_Mesh], desc.entryPointMesh, si)
+                       : lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_VERTEX_BIT, ciModules[Stage_Vert], desc.entryPointVert, si))
+      .shaderStage(lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_FRAGMENT_BIT, ciModules[Stage_Frag], desc.entryPointFrag, si))
       .shaderStage(tescModule ? lvk::getPipelineShaderStageCreateInfo(
-                                    VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT, tescModule->ci, desc.entryPointTesc, &si)
+                                    VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT, ciModules[Stage_Tesc], desc.entryPointTesc, si)
                               : VkPipelineShaderStageCreateInfo{.module = VK_NULL_HANDLE})
       .shaderStage(teseModule ? lvk::getPipelineShaderStageCreateInfo(
-                                    VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, teseModule->ci, desc.entryPointTese, &si)
+                                    VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, ciModules[Stage_Tese], desc.entryPointTese, si)
                               : VkPipelineShaderStageCreateInfo{.module = VK_NULL_HANDLE})
       .shaderStage(geomModule
-                       ? lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_GEOMETRY_BIT, geomModule->ci, desc.entryPointGeom, &si)
+                       ? lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_GEOMETRY_BIT, ciModules[Stage_Geom], desc.entryPointGeom, si)
                        : VkPipelineShaderStageCreateInfo{.module = VK_NULL_HANDLE})
       .cullMode(cullModeToVkCullMode(desc.cullMode))
       .frontFace(windingModeToVkFrontFace(desc.frontFace))
@@ -5753,13 +7767,285 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RenderPipelineHandle handle, uint32
       .colorAttachments(colorBlendAttachmentStates, colorAttachmentFormats, numColorAttachments)
       .depthAttachmentFormat(formatToVkFormat(desc.depthFormat))
       .stencilAttachmentFormat(formatToVkFormat(desc.stencilFormat))
-      .patchControlPoints(desc.patchControlPoints)
-      .build(vkDevice_, pipelineCache_, layout, &pipeline, desc.debugName);
+      .patchControlPoints(desc.patchControlPoints);
+
+  // VK_EXT_graphics_pipeline_library: everything each part depends on, so pipelines which differ in one part share the other ones
+  if (has_EXT_graphics_pipeline_library_) {
+    // libraries can be linked only with identically defined pipeline layouts: hash what defines the layout, not the VkDescriptorSetLayout
+    // handle, which can be reused by the driver once the old layout is destroyed (the Ycbcr samplers live as long as the context)
+    auto hashLayout = [this, &dset, rps, &modules](Hasher& hasher) {
+      hasher.value(dset.maxTextures);
+      hasher.value(dset.maxSamplers);
+      hasher.value(dset.maxAccelStructs);
+      hasher.value(dslNumYUVImages_);
+      hasher.value(dslImmutableSamplers_.size());
+      hasher.bytes(dslImmutableSamplers_.data(), dslImmutableSamplers_.size() * sizeof(VkSampler));
+      hasher.value(rps->shaderStageFlags_);
+      for (const auto& [sm, stage] : modules) {
+        hasher.value(sm ? sm->pushConstantsSize : 0);
+      }
+    };
+    // the key gets the whole SPIR-V code, so different shaders never share a library
+    auto hashShader = [](Hasher& hasher, std::vector<uint8_t>& key, const lvk::ShaderModuleState* sm, const char* entryPoint) {
+      hasher.value(sm ? sm->spirvHash : 0);
+      hasher.value(sm ? sm->ci.codeSize : 0);
+      hasher.string(sm ? entryPoint : nullptr);
+      if (sm) {
+        key.insert(key.end(), (const uint8_t*)sm->ci.pCode, (const uint8_t*)sm->ci.pCode + sm->ci.codeSize);
+      }
+    };
+    Hasher vertexInput(&job->libraryKeys[0]);
+    vertexInput.value(desc.topology);
+    vertexInput.value(rps->numBindings_);
+    vertexInput.bytes(rps->vkBindings_, rps->numBindings_ * sizeof(VkVertexInputBindingDescription));
+    vertexInput.value(rps->numAttributes_);
+    vertexInput.bytes(rps->vkAttributes_, rps->numAttributes_ * sizeof(VkVertexInputAttributeDescription));
+    Hasher preRasterization(&job->libraryKeys[1]);
+    hashLayout(preRasterization);
+    hashShader(preRasterization, job->libraryKeys[1], vertModule, desc.entryPointVert);
+    hashShader(preRasterization, job->libraryKeys[1], tescModule, desc.entryPointTesc);
+    hashShader(preRasterization, job->libraryKeys[1], teseModule, desc.entryPointTese);
+    hashShader(preRasterization, job->libraryKeys[1], geomModule, desc.entryPointGeom);
+    hashShader(preRasterization, job->libraryKeys[1], taskModule, desc.entryPointTask);
+    hashShader(preRasterization, job->libraryKeys[1], meshModule, desc.entryPointMesh);
+    preRasterization.specInfo(desc.specInfo);
+    preRasterization.value(desc.topology);
+    preRasterization.value(desc.cullMode);
+    preRasterization.value(desc.frontFace);
+    preRasterization.value(desc.polygonMode);
+    preRasterization.value(desc.patchControlPoints);
+    preRasterization.value(viewMask);
+    Hasher fragmentShader(&job->libraryKeys[2]);
+    hashLayout(fragmentShader);
+    hashShader(fragmentShader, job->libraryKeys[2], fragModule, desc.entryPointFrag);
+    fragmentShader.specInfo(desc.specInfo);
+    for (const StencilState& stencil : {desc.backFaceStencil, desc.frontFaceStencil}) {
+      fragmentShader.value(stencil.stencilFailureOp);
+      fragmentShader.value(stencil.depthFailureOp);
+      fragmentShader.value(stencil.depthStencilPassOp);
+      fragmentShader.value(stencil.stencilCompareOp);
+      fragmentShader.value(stencil.readMask);
+      fragmentShader.value(stencil.writeMask);
+    }
+    fragmentShader.value(desc.depthFormat);
+    fragmentShader.value(desc.stencilFormat);
+    fragmentShader.value(viewMask);
+    Hasher fragmentOutput(&job->libraryKeys[3]);
+    fragmentOutput.value(numColorAttachments);
+    fragmentOutput.bytes(colorAttachmentFormats, numColorAttachments * sizeof(VkFormat));
+    fragmentOutput.bytes(colorBlendAttachmentStates, numColorAttachments * sizeof(VkPipelineColorBlendAttachmentState));
+    fragmentOutput.value(desc.depthFormat);
+    fragmentOutput.value(desc.stencilFormat);
+    fragmentOutput.value(viewMask);
+    // the multisample state is used by both fragment parts
+    for (Hasher* hasher : {&fragmentShader, &fragmentOutput}) {
+      hasher->value(desc.samplesCount);
+      hasher->value(desc.minSampleShading);
+      hasher->value(desc.alphaToCoverage);
+    }
+    // mesh shading pipelines have no vertex input
+    job->libraryHashes[0] = meshModule ? 0 : vertexInput.get();
+    if (meshModule) {
+      job->libraryKeys[0].clear();
+    }
+    job->libraryHashes[1] = preRasterization.get();
+    job->libraryHashes[2] = fragmentShader.get();
+    job->libraryHashes[3] = fragmentOutput.get();
+  }
+
+  job->layout = layout;
+  job->debugName = desc.debugName;
+  job->task = std::packaged_task<void()>([this, job]() { compileRenderPipeline(*job); });
+  job->done = job->task.get_future();
+  variant->compileJob = job;
+
+  if (wait || pimpl_->pipelineCompileThreads_.empty()) {
+    job->task();
+    finishPipelineCompilation(*variant);
+    return variant->pipeline;
+  }
+
+  {
+    std::lock_guard lock(pimpl_->pipelineCompileMutex_);
+    pimpl_->pipelineCompileQueue_.push_back(job);
+  }
+  pimpl_->pipelineCompileCondition_.notify_one();
+
+  return VK_NULL_HANDLE;
+}
+
+void lvk::VulkanContext::finishPipelineCompilation(RenderPipelineState& rps) {
+  for (uint32_t i = 0; i != rps.numVariants_; i++) {
+    finishPipelineCompilation(rps.variants_[i]);
+  }
+}
+
+void lvk::VulkanContext::finishPipelineCompilation(RenderPipelineState::Variant& variant, bool waitForOptimizedLink) {
+  while (RenderPipelineCompileJob* job = variant.compileJob) {
+    if (job->isOptimizedLink && !waitForOptimizedLink && !job->isReady()) {
+      return;
+    }
+
+    bool isQueued = false;
+    {
+      std::lock_guard lock(pimpl_->pipelineCompileMutex_);
+      std::deque<RenderPipelineCompileJob*>& queue = pimpl_->pipelineCompileQueue_;
+      auto it = std::find(queue.begin(), queue.end(), job);
+      if (it != queue.end()) {
+        queue.erase(it);
+        isQueued = true;
+      }
+    }
+
+    if (isQueued && job->isOptimizedLink) {
+      // keep using the fast-linked pipeline
+      variant.compileJob = nullptr;
+      delete job;
+      return;
+    }
+
+    // no compilation thread got to it yet, so do not wait for one
+    if (isQueued) {
+      job->task();
+    }
+
+    job->done.wait();
+
+    if (job->isOptimizedLink && job->pipeline != VK_NULL_HANDLE) {
+      // the fast-linked pipeline can still be used by command buffers in flight
+      deferredTask(std::packaged_task<void()>(
+          [device = getVkDevice(), pipeline = variant.pipeline]() { vkDestroyPipeline(device, pipeline, nullptr); }));
+    }
+    if (!job->isOptimizedLink || job->pipeline != VK_NULL_HANDLE) {
+      variant.pipeline = job->pipeline;
+    }
+    // the optimized link of a fast-linked pipeline keeps running in the background
+    variant.compileJob = job->optimizedLinkJob;
+
+    delete job;
+  }
+}
+
+void lvk::VulkanContext::compileRenderPipeline(RenderPipelineCompileJob& job) {
+  // VkPipelineCache is internally synchronized
+  if (job.isOptimizedLink) {
+    job.builder.link(vkDevice_, pipelineCache_, job.layout, job.libraries, job.numLibraries, true, &job.pipeline, job.debugName);
+    return;
+  }
+
+  job.numLibraries = 0;
+  for (uint32_t i = 0; i != LVK_ARRAY_NUM_ELEMENTS(kPipelineLibraryParts); i++) {
+    if (!job.libraryHashes[i]) {
+      continue;
+    }
+    const VkPipeline library = getPipelineLibrary(job, kPipelineLibraryParts[i], job.libraryHashes[i], job.libraryKeys[i]);
+    if (library == VK_NULL_HANDLE) {
+      job.numLibraries = 0;
+      break;
+    }
+    job.libraries[job.numLibraries++] = library;
+  }
+
+  // monolithic pipelines without VK_EXT_graphics_pipeline_library (or if any library failed)
+  if (!job.numLibraries) {
+    job.builder.build(vkDevice_, pipelineCache_, job.layout, &job.pipeline, job.debugName);
+    return;
+  }
+
+  if (job.builder.link(vkDevice_, pipelineCache_, job.layout, job.libraries, job.numLibraries, false, &job.pipeline, job.debugName) !=
+      VK_SUCCESS) {
+    return;
+  }
+
+  // without compilation threads, the fast-linked pipeline stays
+  if (pimpl_->pipelineCompileThreads_.empty()) {
+    return;
+  }
+
+  RenderPipelineCompileJob* optimizedJob = new RenderPipelineCompileJob();
+  optimizedJob->builder = job.builder; // only the creation flags are used to link
+  optimizedJob->layout = job.layout;
+  optimizedJob->debugName = job.debugName;
+  optimizedJob->numLibraries = job.numLibraries;
+  memcpy(optimizedJob->libraries, job.libraries, sizeof(job.libraries));
+  optimizedJob->isOptimizedLink = true;
+  optimizedJob->task = std::packaged_task<void()>([this, optimizedJob]() { compileRenderPipeline(*optimizedJob); });
+  optimizedJob->done = optimizedJob->task.get_future();
+
+  {
+    std::lock_guard lock(pimpl_->pipelineCompileMutex_);
+    if (pimpl_->pipelineCompileExit_) {
+      delete optimizedJob;
+      return;
+    }
+    pimpl_->pipelineCompileQueue_.push_back(optimizedJob);
+  }
+  pimpl_->pipelineCompileCondition_.notify_one();
+
+  job.optimizedLinkJob = optimizedJob;
+}
+
+VkPipeline lvk::VulkanContext::getPipelineLibrary(RenderPipelineCompileJob& job,
+                                                  VkGraphicsPipelineLibraryFlagsEXT part,
+                                                  uint64_t hash,
+                                                  const std::vector<uint8_t>& key) {
+  // different parts never share a library, even if their hashes happen to be equal
+  Hasher hasher;
+  hasher.value(part);
+  hasher.value(hash);
+  const uint64_t libraryHash = hasher.get();
+
+  // a hash collision with another library: build a monolithic pipeline instead
+  auto isSameLibrary = [part, &key](const VulkanContextImpl::PipelineLibrary& library) {
+    return library.part == part && library.key == key;
+  };
+
+  {
+    std::lock_guard lock(pimpl_->pipelineLibrariesMutex_);
+    auto it = pimpl_->pipelineLibraries_.find(libraryHash);
+    if (it != pimpl_->pipelineLibraries_.end()) {
+      return isSameLibrary(it->second) ? it->second.pipeline : VK_NULL_HANDLE;
+    }
+  }
+
+  // do not block other threads while compiling
+  VkPipeline library = VK_NULL_HANDLE;
+  if (job.builder.buildLibrary(vkDevice_, pipelineCache_, job.layout, part, &library, job.debugName) != VK_SUCCESS) {
+    return VK_NULL_HANDLE;
+  }
 
-  rps->pipeline_ = pipeline;
-  rps->pipelineLayout_ = layout;
+  std::lock_guard lock(pimpl_->pipelineLibrariesMutex_);
+  const auto [it, isInserted] =
+      pimpl_->pipelineLibraries_.emplace(libraryHash, VulkanContextImpl::PipelineLibrary{.part = part, .key = key, .pipeline = library});
+  if (!isInserted) {
+    // another thread has just built the same library (or a colliding one)
+    vkDestroyPipeline(vkDevice_, library, nullptr);
+    return isSameLibrary(it->second) ? it->second.pipeline : VK_NULL_HANDLE;
+  }
+  return it->second.pipeline;
+}
+
+bool lvk::VulkanContext::isPipelineReady(RenderPipelineHandle handle, uint32_t viewMask) {
+  return getVkPipeline(handle, viewMask, false) != VK_NULL_HANDLE;
+}
+
+void lvk::VulkanContext::warmupPipelines(const ldr::Span<RenderPipelineHandle>& pipelines, const ldr::Span<uint32_t>& viewMasks) {
+  LVK_PROFILER_FUNCTION();
+
+  const uint32_t defaultViewMask = 0;
+  const uint32_t* masks = viewMasks.empty() ? &defaultViewMask : viewMasks.data();
+  const uint32_t numMasks = viewMasks.empty() ? 1u : (uint32_t)viewMasks.size();
+
+  LVK_ASSERT_MSG(numMasks <= RenderPipelineState::LVK_MAX_PIPELINE_VARIANTS, "Too many view masks, some variants will be evicted");
 
-  return pipeline;
+  // queue everything first, so that the pipeline compilation threads build the variants in parallel
+  for (bool wait : {false, true}) {
+    for (RenderPipelineHandle handle : pipelines) {
+      for (uint32_t i = 0; i != numMasks; i++) {
+        (void)getVkPipeline(handle, masks[i], wait);
+      }
+    }
+  }
 }
 
 VkPipeline lvk::VulkanContext::getVkPipeline(RayTracingPipelineHandle handle) {
@@ -5934,6 +8220,7 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RayTracingPipelineHandle handle) {
 
   const VkRayTracingPipelineCreateInfoKHR ciRayTracingPipeline = {
       .sType = VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR,
+      .flags = has_EXT_descriptor_buffer_ ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0u,
       .stageCount = numShaderStages,
       .pStages = ciShaderStages.data(),
       .groupCount = numShaderGroups,
@@ -6004,6 +8291,10 @@ VkPipeline lvk::VulkanContext::getVkPipeline(RayTracingPipelineHandle handle) {
 VkPipeline lvk::VulkanContext::getVkPipeline(ComputePipelineHandle handle) {
   lvk::ComputePipelineState* cps = computePipelinesPool_.get(handle);
 
+  if (cps && cps->owner_.valid()) {
+    cps = computePipelinesPool_.get(cps->owner_);
+  }
+
   if (!cps) {
     return VK_NULL_HANDLE;
   }
@@ -6055,7 +8346,7 @@ VkPipeline lvk::VulkanContext::getVkPipeline(ComputePipelineHandle handle) {
 
     const VkComputePipelineCreateInfo ci = {
         .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
-        .flags = 0,
+        .flags = has_EXT_descriptor_buffer_ ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0u,
         .stage = lvk::getPipelineShaderStageCreateInfo(VK_SHADER_STAGE_COMPUTE_BIT, sm->ci, cps->desc_.entryPoint, &siComp),
         .layout = cps->pipelineLayout_,
         .basePipelineHandle = VK_NULL_HANDLE,
@@ -6068,6 +8359,18 @@ VkPipeline lvk::VulkanContext::getVkPipeline(ComputePipelineHandle handle) {
   return cps->pipeline_;
 }
 
+bool lvk::VulkanContext::isSameShaderModule(ShaderModuleHandle a, ShaderModuleHandle b) const {
+  const lvk::ShaderModuleState* smA = shaderModulesPool_.get(a);
+  const lvk::ShaderModuleState* smB = shaderModulesPool_.get(b);
+
+  if (!smA || !smB) {
+    // a destroyed shader module cannot be compared anymore
+    return !smA && !smB && a.empty() && b.empty();
+  }
+
+  return smA == smB || (smA->ci.codeSize == smB->ci.codeSize && memcmp(smA->ci.pCode, smB->ci.pCode, smA->ci.codeSize) == 0);
+}
+
 lvk::Holder<lvk::ComputePipelineHandle> lvk::VulkanContext::createComputePipeline(const ComputePipelineDesc& desc, Result* outResult) {
   if (!LVK_VERIFY(desc.smComp.valid())) {
     Result::setResult(outResult, Result::Code::ArgumentOutOfRange, "Missing compute shader");
@@ -6083,7 +8386,34 @@ lvk::Holder<lvk::ComputePipelineHandle> lvk::VulkanContext::createComputePipelin
     cps.desc_.specInfo.data = cps.specConstantDataStorage_;
   }
 
-  return {this, computePipelinesPool_.create(std::move(cps))};
+  // everything the VkPipeline depends on; debugName is per handle
+  {
+    const lvk::ShaderModuleState* sm = shaderModulesPool_.get(desc.smComp);
+    Hasher hasher(&cps.key_);
+    hasher.value(sm ? sm->spirvHash : 0);
+    hasher.value(sm ? sm->ci.codeSize : 0);
+    hasher.string(desc.entryPoint);
+    hasher.specInfo(cps.desc_.specInfo);
+    cps.hash_ = hasher.get();
+  }
+
+  std::vector<ComputePipelineHandle>& group = pimpl_->computePipelineGroups_[cps.hash_];
+
+  // equal hashes are only a pre-filter; a pipeline whose hash collides with a different one stays out of the group
+  const lvk::ComputePipelineState* owner = group.empty() ? nullptr : computePipelinesPool_.get(group.front());
+  const bool isIdentical = owner && owner->key_ == cps.key_ && isSameShaderModule(owner->desc_.smComp, desc.smComp);
+
+  if (isIdentical) {
+    cps.owner_ = group.front();
+  }
+
+  const ComputePipelineHandle handle = computePipelinesPool_.create(std::move(cps));
+
+  if (group.empty() || isIdentical) {
+    group.push_back(handle);
+  }
+
+  return {this, handle};
 }
 
 lvk::Holder<lvk::RayTracingPipelineHandle> lvk::VulkanContext::createRayTracingPipeline(const RayTracingPipelineDesc& desc,
@@ -6200,7 +8530,92 @@ lvk::Holder<lvk::RenderPipelineHandle> lvk::VulkanContext::createRenderPipeline(
     rps.desc_.specInfo.data = rps.specConstantDataStorage_;
   }
 
-  return {this, renderPipelinesPool_.create(std::move(rps))};
+  // everything the VkPipeline depends on (shaders by contents, normalized state); debugName and fallbackPipeline are per handle
+  {
+    Hasher hasher(&rps.key_);
+    hasher.value(desc.topology);
+    hasher.value(rps.numBindings_);
+    hasher.bytes(rps.vkBindings_, rps.numBindings_ * sizeof(VkVertexInputBindingDescription));
+    hasher.value(rps.numAttributes_);
+    hasher.bytes(rps.vkAttributes_, rps.numAttributes_ * sizeof(VkVertexInputAttributeDescription));
+    const std::pair<ShaderModuleHandle, const char*> stages[] = {
+        {desc.smVert, desc.entryPointVert},
+        {desc.smTesc, desc.entryPointTesc},
+        {desc.smTese, desc.entryPointTese},
+        {desc.smGeom, desc.entryPointGeom},
+        {desc.smTask, desc.entryPointTask},
+        {desc.smMesh, desc.entryPointMesh},
+        {desc.smFrag, desc.entryPointFrag},
+    };
+    for (const auto& [sm, entryPoint] : stages) {
+      const lvk::ShaderModuleState* state = shaderModulesPool_.get(sm);
+      hasher.value(state ? state->spirvHash : 0);
+      hasher.value(state ? state->ci.codeSize : 0);
+      hasher.string(state ? entryPoint : nullptr);
+    }
+    hasher.specInfo(rps.desc_.specInfo);
+    for (const ColorAttachment& attachment : desc.color) {
+      hasher.value(attachment.format);
+      hasher.value(attachment.blendEnabled);
+      // blend factors are ignored when blending is disabled
+      if (attachment.blendEnabled) {
+        hasher.value(attachment.rgbBlendOp);
+        hasher.value(attachment.alphaBlendOp);
+        hasher.value(attachment.srcRGBBlendFactor);
+        hasher.value(attachment.srcAlphaBlendFactor);
+        hasher.value(attachment.dstRGBBlendFactor);
+        hasher.value(attachment.dstAlphaBlendFactor);
+      }
+    }
+    hasher.value(desc.depthFormat);
+    hasher.value(desc.stencilFormat);
+    hasher.value(desc.cullMode);
+    hasher.value(desc.frontFace);
+    hasher.value(desc.polygonMode);
+    for (const StencilState& stencil : {desc.backFaceStencil, desc.frontFaceStencil}) {
+      hasher.value(stencil.stencilFailureOp);
+      hasher.value(stencil.depthFailureOp);
+      hasher.value(stencil.depthStencilPassOp);
+      hasher.value(stencil.stencilCompareOp);
+      hasher.value(stencil.readMask);
+      hasher.value(stencil.writeMask);
+    }
+    hasher.value(desc.samplesCount);
+    hasher.value(desc.patchControlPoints);
+    hasher.value(desc.minSampleShading);
+    hasher.value(desc.alphaToCoverage);
+    rps.hash_ = hasher.get();
+  }
+
+  RenderPipelineHandle handle;
+  {
+    std::lock_guard lock(pimpl_->renderPipelinesMutex_);
+    std::vector<RenderPipelineHandle>& group = pimpl_->renderPipelineGroups_[rps.hash_];
+    // equal hashes are only a pre-filter; a pipeline whose hash collides with a different one stays out of the group
+    const lvk::RenderPipelineState* owner = group.empty() ? nullptr : renderPipelinesPool_.get(group.front());
+    const bool isIdentical = owner && owner->key_ == rps.key_ &&
+                             isSameShaderModule(owner->desc_.smVert, desc.smVert) &&
+                             isSameShaderModule(owner->desc_.smTesc, desc.smTesc) &&
+                             isSameShaderModule(owner->desc_.smTese, desc.smTese) &&
+                             isSameShaderModule(owner->desc_.smGeom, desc.smGeom) &&
+                             isSameShaderModule(owner->desc_.smTask, desc.smTask) &&
+                             isSameShaderModule(owner->desc_.smMesh, desc.smMesh) &&
+                             isSameShaderModule(owner->desc_.smFrag, desc.smFrag);
+    if (isIdentical) {
+      rps.owner_ = group.front();
+    }
+    handle = renderPipelinesPool_.create(std::move(rps));
+    if (group.empty() || isIdentical) {
+      group.push_back(handle);
+    }
+  }
+
+  if (!pimpl_->pipelineCompileThreads_.empty()) {
+    // start compiling the common case (no multiview) right away
+    (void)getVkPipeline(handle, 0, false);
+  }
+
+  return {this, handle};
 }
 
 void lvk::VulkanContext::destroy(lvk::RayTracingPipelineHandle handle) {
@@ -6227,7 +8642,30 @@ void lvk::VulkanContext::destroy(lvk::ComputePipelineHandle handle) {
     return;
   }
 
-  free(cps->specConstantDataStorage_);
+  free(cps->specConstantDataStorage_);
+
+  std::vector<ComputePipelineHandle>& group = pimpl_->computePipelineGroups_[cps->hash_];
+  // not in the group if its hash collided with a different pipeline
+  const bool isGrouped = std::find(group.begin(), group.end(), handle) != group.end();
+  group.erase(std::remove(group.begin(), group.end(), handle), group.end());
+
+  if (isGrouped && cps->owner_.empty() && !group.empty()) {
+    // hand the Vulkan objects over to the next identical pipeline
+    lvk::ComputePipelineState* newOwner = computePipelinesPool_.get(group.front());
+    newOwner->owner_ = {};
+    newOwner->lastVkDescriptorSetLayout_ = cps->lastVkDescriptorSetLayout_;
+    newOwner->pipelineLayout_ = cps->pipelineLayout_;
+    newOwner->pipeline_ = cps->pipeline_;
+    for (size_t i = 1; i != group.size(); i++) {
+      computePipelinesPool_.get(group[i])->owner_ = group.front();
+    }
+    cps->pipelineLayout_ = VK_NULL_HANDLE;
+    cps->pipeline_ = VK_NULL_HANDLE;
+  }
+
+  if (group.empty()) {
+    pimpl_->computePipelineGroups_.erase(cps->hash_);
+  }
 
   deferredTask(
       std::packaged_task<void()>([device = getVkDevice(), pipeline = cps->pipeline_]() { vkDestroyPipeline(device, pipeline, nullptr); }));
@@ -6238,6 +8676,8 @@ void lvk::VulkanContext::destroy(lvk::ComputePipelineHandle handle) {
 }
 
 void lvk::VulkanContext::destroy(lvk::RenderPipelineHandle handle) {
+  std::lock_guard lock(pimpl_->renderPipelinesMutex_);
+
   lvk::RenderPipelineState* rps = renderPipelinesPool_.get(handle);
 
   if (!rps) {
@@ -6246,8 +8686,37 @@ void lvk::VulkanContext::destroy(lvk::RenderPipelineHandle handle) {
 
   free(rps->specConstantDataStorage_);
 
-  deferredTask(
-      std::packaged_task<void()>([device = getVkDevice(), pipeline = rps->pipeline_]() { vkDestroyPipeline(device, pipeline, nullptr); }));
+  std::vector<RenderPipelineHandle>& group = pimpl_->renderPipelineGroups_[rps->hash_];
+  // not in the group if its hash collided with a different pipeline
+  const bool isGrouped = std::find(group.begin(), group.end(), handle) != group.end();
+  group.erase(std::remove(group.begin(), group.end(), handle), group.end());
+
+  if (isGrouped && rps->owner_.empty() && !group.empty()) {
+    // hand the Vulkan objects (and pending compilations) over to the next identical pipeline
+    lvk::RenderPipelineState* newOwner = renderPipelinesPool_.get(group.front());
+    newOwner->owner_ = {};
+    newOwner->lastVkDescriptorSetLayout_ = rps->lastVkDescriptorSetLayout_;
+    newOwner->shaderStageFlags_ = rps->shaderStageFlags_;
+    newOwner->pipelineLayout_ = rps->pipelineLayout_;
+    std::copy(rps->variants_, rps->variants_ + rps->numVariants_, newOwner->variants_);
+    newOwner->numVariants_ = rps->numVariants_;
+    for (size_t i = 1; i != group.size(); i++) {
+      renderPipelinesPool_.get(group[i])->owner_ = group.front();
+    }
+    rps->pipelineLayout_ = VK_NULL_HANDLE;
+    rps->numVariants_ = 0;
+  }
+
+  if (group.empty()) {
+    pimpl_->renderPipelineGroups_.erase(rps->hash_);
+  }
+
+  finishPipelineCompilation(*rps);
+
+  for (uint32_t i = 0; i != rps->numVariants_; i++) {
+    deferredTask(std::packaged_task<void()>(
+        [device = getVkDevice(), pipeline = rps->variants_[i].pipeline]() { vkDestroyPipeline(device, pipeline, nullptr); }));
+  }
   deferredTask(std::packaged_task<void()>(
       [device = getVkDevice(), layout = rps->pipelineLayout_]() { vkDestroyPipelineLayout(device, layout, nullptr); }));
 
@@ -6261,6 +8730,16 @@ void lvk::VulkanContext::destroy(lvk::ShaderModuleHandle handle) {
     return;
   }
 
+  if (!pimpl_->pipelineCompileThreads_.empty()) {
+    // pipelines being compiled in the background can still read the SPIR-V code; optimized links only link existing libraries
+    std::lock_guard lock(pimpl_->renderPipelinesMutex_);
+    for (lvk::RenderPipelineState& rps : renderPipelinesPool_.objects_) {
+      for (uint32_t i = 0; i != rps.numVariants_; i++) {
+        finishPipelineCompilation(rps.variants_[i], false);
+      }
+    }
+  }
+
   free((void*)state->ci.pCode);
 
   shaderModulesPool_.destroy(handle);
@@ -6313,6 +8792,7 @@ void lvk::VulkanContext::destroy(lvk::TextureHandle handle) {
   SCOPE_EXIT {
     texturesPool_.destroy(handle);
     awaitingCreation_ = true; // make the validation layers happy
+    dirtyTextures_.push_back(handle.index());
   };
 
   lvk::VulkanImage* tex = texturesPool_.get(handle);
@@ -6396,6 +8876,18 @@ void lvk::VulkanContext::destroy(lvk::AccelStructHandle handle) {
       [device = vkDevice_, as = accelStruct->vkHandle]() { vkDestroyAccelerationStructureKHR(device, as, nullptr); }));
 }
 
+void lvk::VulkanContext::destroy(lvk::CommandListHandle handle) {
+  CommandListState* list = commandListsPool_.get(handle);
+
+  if (!list) {
+    return;
+  }
+
+  secondaryCommands_->destroy(*list);
+
+  commandListsPool_.destroy(handle);
+}
+
 void lvk::VulkanContext::destroy(Framebuffer& fb) {
   auto destroyFbTexture = [this](TextureHandle& handle) {
     {
@@ -6468,7 +8960,11 @@ lvk::Result lvk::VulkanContext::download(lvk::BufferHandle handle, void* data, s
     return Result(Result::Code::ArgumentOutOfRange, "Out of range");
   }
 
-  buf->getBufferSubData(*this, offset, size, data);
+  if (buf->isMapped()) {
+    buf->getBufferSubData(*this, offset, size, data);
+  } else {
+    stagingDevice_->getBufferData(*buf, offset, size, data);
+  }
 
   return Result();
 }
@@ -6541,6 +9037,142 @@ lvk::Result lvk::VulkanContext::download(lvk::TextureHandle handle, const Textur
   return Result();
 }
 
+lvk::ReadbackTicket lvk::VulkanContext::downloadAsync(lvk::BufferHandle handle, size_t size, size_t offset, Result* outResult) {
+  LVK_PROFILER_FUNCTION();
+
+  LVK_ASSERT_MSG(size, "Data size should be non-zero");
+
+  lvk::VulkanBuffer* buf = buffersPool_.get(handle);
+
+  if (!LVK_VERIFY(buf)) {
+    Result::setResult(outResult, Result::Code::ArgumentOutOfRange);
+    return {};
+  }
+
+  if (!LVK_VERIFY(offset + size <= buf->bufferSize_)) {
+    Result::setResult(outResult, Result::Code::ArgumentOutOfRange, "Out of range");
+    return {};
+  }
+
+  if (!LVK_VERIFY(buf->vkUsageFlags_ & VK_BUFFER_USAGE_TRANSFER_SRC_BIT)) {
+    Result::setResult(outResult, Result::Code::ArgumentOutOfRange, "Host-visible buffers should be read via getMappedPtr()");
+    return {};
+  }
+
+  Result::setResult(outResult, Result());
+
+  return stagingDevice_->readbackBuffer(*buf, offset, size);
+}
+
+lvk::ReadbackTicket lvk::VulkanContext::downloadAsync(lvk::TextureHandle handle, const TextureRangeDesc& range, Result* outResult) {
+  LVK_PROFILER_FUNCTION();
+
+  lvk::VulkanImage* texture = texturesPool_.get(handle);
+
+  if (!LVK_VERIFY(texture)) {
+    Result::setResult(outResult, Result::Code::ArgumentOutOfRange);
+    return {};
+  }
+
+  // VUID-VkBufferImageCopy2-aspectMask-09103 (see download() above)
+  if (!LVK_VERIFY(!(texture->isDepthFormat_ && texture->isStencilFormat_))) {
+    Result::setResult(outResult, Result::Code::ArgumentOutOfRange, "Cannot download combined depth/stencil textures");
+    return {};
+  }
+
+  const Result result = validateRange(texture->vkExtent_, texture->numLevels_, range);
+
+  if (!LVK_VERIFY(result.isOk())) {
+    Result::setResult(outResult, result);
+    return {};
+  }
+
+  Result::setResult(outResult, Result());
+
+  return stagingDevice_->readbackImage(*texture,
+                                       VkOffset3D{range.offset.x, range.offset.y, range.offset.z},
+                                       VkExtent3D{range.dimensions.width, range.dimensions.height, range.dimensions.depth},
+                                       VkImageSubresourceRange{
+                                           .aspectMask = texture->getImageAspectFlags(),
+                                           .baseMipLevel = range.mipLevel,
+                                           .levelCount = range.numMipLevels,
+                                           .baseArrayLayer = range.layer,
+                                           .layerCount = range.numLayers,
+                                       },
+                                       texture->vkImageFormat_);
+}
+
+const void* lvk::VulkanContext::getReadbackData(const ReadbackTicket& ticket) {
+  return stagingDevice_->getReadbackData(ticket);
+}
+
+void lvk::VulkanContext::releaseReadback(const ReadbackTicket& ticket) {
+  stagingDevice_->releaseReadback(ticket);
+}
+
+lvk::StagingReservation lvk::VulkanContext::reserveStaging(size_t size, Result* outResult) {
+  return stagingDevice_->reserve(size, outResult);
+}
+
+void lvk::VulkanContext::cancelStaging(const StagingReservation& reservation) {
+  stagingDevice_->cancelReservation(reservation);
+}
+
+lvk::Result lvk::VulkanContext::upload(lvk::BufferHandle handle, const StagingReservation& reservation, size_t offset) {
+  LVK_PROFILER_FUNCTION();
+
+  if (!LVK_VERIFY(!reservation.empty())) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  lvk::VulkanBuffer* buf = buffersPool_.get(handle);
+
+  if (!LVK_VERIFY(buf)) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  if (!LVK_VERIFY(offset + reservation.size <= buf->bufferSize_)) {
+    return Result(Result::Code::ArgumentOutOfRange, "Out of range");
+  }
+
+  stagingDevice_->bufferSubData(*buf, offset, reservation);
+
+  return Result();
+}
+
+lvk::Result lvk::VulkanContext::upload(lvk::TextureHandle handle, const TextureRangeDesc& range, const StagingReservation& reservation) {
+  LVK_PROFILER_FUNCTION();
+
+  if (!LVK_VERIFY(!reservation.empty())) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  lvk::VulkanImage* texture = texturesPool_.get(handle);
+
+  if (!LVK_VERIFY(texture)) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  if (!LVK_VERIFY(texture->vkType_ != VK_IMAGE_TYPE_3D)) {
+    return Result(Result::Code::ArgumentOutOfRange, "3D textures cannot be uploaded from staging reservations");
+  }
+
+  const Result result = validateRange(texture->vkExtent_, texture->numLevels_, range);
+
+  if (!LVK_VERIFY(result.isOk())) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  const VkRect2D imageRegion = {
+      .offset = {.x = range.offset.x, .y = range.offset.y},
+      .extent = {.width = range.dimensions.width, .height = range.dimensions.height},
+  };
+  stagingDevice_->imageData2D(
+      *texture, imageRegion, range.mipLevel, range.numMipLevels, range.layer, range.numLayers, texture->vkImageFormat_, reservation);
+
+  return Result();
+}
+
 lvk::Result lvk::VulkanContext::upload(lvk::TextureHandle handle,
                                        const TextureRangeDesc& range,
                                        const void* data,
@@ -6583,6 +9215,135 @@ lvk::Result lvk::VulkanContext::upload(lvk::TextureHandle handle,
   return Result();
 }
 
+lvk::Result lvk::VulkanContext::uploadFromFile(lvk::BufferHandle handle,
+                                               const char* fileName,
+                                               size_t fileOffset,
+                                               size_t size,
+                                               size_t offset) {
+  LVK_PROFILER_FUNCTION();
+
+  if (!LVK_VERIFY(fileName)) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  LVK_ASSERT_MSG(size, "Data size should be non-zero");
+
+  lvk::VulkanBuffer* buf = buffersPool_.get(handle);
+
+  if (!LVK_VERIFY(buf)) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  if (!LVK_VERIFY(offset + size <= buf->bufferSize_)) {
+    return Result(Result::Code::ArgumentOutOfRange, "Out of range");
+  }
+
+  FILE* file = openFileAt(fileName, fileOffset, size);
+
+  if (!file) {
+    LLOGW("Cannot open file %s (or it is too short)\n", fileName);
+    return Result(Result::Code::RuntimeError, "Cannot open file");
+  }
+
+  SCOPE_EXIT {
+    fclose(file);
+  };
+
+  if (!stagingDevice_->bufferSubDataFromFile(*buf, offset, size, file)) {
+    return Result(Result::Code::RuntimeError, "Cannot read file");
+  }
+
+  return Result();
+}
+
+lvk::Result lvk::VulkanContext::uploadFromFile(lvk::TextureHandle handle,
+                                               const TextureRangeDesc& range,
+                                               const char* fileName,
+                                               size_t fileOffset) {
+  LVK_PROFILER_FUNCTION();
+
+  if (!LVK_VERIFY(fileName)) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  lvk::VulkanImage* texture = texturesPool_.get(handle);
+
+  if (!LVK_VERIFY(texture)) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  if (!LVK_VERIFY(texture->vkType_ != VK_IMAGE_TYPE_3D)) {
+    return Result(Result::Code::ArgumentOutOfRange, "3D textures cannot be uploaded from files");
+  }
+
+  const Result result = validateRange(texture->vkExtent_, texture->numLevels_, range);
+
+  if (!LVK_VERIFY(result.isOk())) {
+    return Result(Result::Code::ArgumentOutOfRange);
+  }
+
+  const uint64_t storageSize = getImageStorageSize2D(
+      range.dimensions.width, range.dimensions.height, vkFormatToFormat(texture->vkImageFormat_), range.numMipLevels, range.numLayers);
+
+  FILE* file = openFileAt(fileName, fileOffset, storageSize);
+
+  if (!file) {
+    LLOGW("Cannot open file %s (or it is too short)\n", fileName);
+    return Result(Result::Code::RuntimeError, "Cannot open file");
+  }
+
+  SCOPE_EXIT {
+    fclose(file);
+  };
+
+  const VkRect2D imageRegion = {
+      .offset = {.x = range.offset.x, .y = range.offset.y},
+      .extent = {.width = range.dimensions.width, .height = range.dimensions.height},
+  };
+  if (!stagingDevice_->imageData2DFromFile(
+          *texture, imageRegion, range.mipLevel, range.numMipLevels, range.layer, range.numLayers, texture->vkImageFormat_, file)) {
+    return Result(Result::Code::RuntimeError, "Cannot read file");
+  }
+
+  return Result();
+}
+
+void lvk::VulkanContext::beginUploadBatch() {
+  stagingDevice_->beginBatch();
+}
+
+lvk::SubmitHandle lvk::VulkanContext::endUploadBatch() {
+  return stagingDevice_->endBatch();
+}
+
+lvk::ICommandBuffer& lvk::VulkanContext::acquireSecondaryCommandBuffer(uint32_t threadIndex,
+                                                                     const RenderPass& renderPass,
+                                                                     const Framebuffer& fb) {
+  return secondaryCommands_->acquire(threadIndex, renderPass, fb);
+}
+
+void lvk::VulkanContext::endSecondaryCommandBuffer(ICommandBuffer& commandBuffer) {
+  secondaryCommands_->end(static_cast<lvk::CommandBuffer&>(commandBuffer));
+}
+
+lvk::Holder<lvk::CommandListHandle> lvk::VulkanContext::createCommandList(std::function<void(ICommandBuffer& cmdBuffer)> record,
+                                                                          const char* debugName,
+                                                                          Result* outResult) {
+  if (!LVK_VERIFY(record)) {
+    Result::setResult(outResult, Result::Code::ArgumentOutOfRange, "Invalid command list recording function");
+    return {};
+  }
+
+  CommandListState list = {
+      .record_ = std::move(record),
+      .debugName_ = debugName ? debugName : "",
+  };
+
+  Result::setResult(outResult, Result());
+
+  return {this, commandListsPool_.create(std::move(list))};
+}
+
 lvk::Dimensions lvk::VulkanContext::getDimensions(TextureHandle handle) const {
   if (!handle) {
     return {};
@@ -6631,9 +9392,10 @@ void lvk::VulkanContext::generateMipmap(TextureHandle handle) const {
   }
 
   LVK_ASSERT(tex->vkImageLayout_ != VK_IMAGE_LAYOUT_UNDEFINED);
-  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = immediate_->acquire();
+  // goes through the staging device to stay ordered after the mip-level 0 upload when it is recorded into an upload batch
+  const lvk::VulkanImmediateCommands::CommandBufferWrapper& wrapper = stagingDevice_->acquireCommandBuffer();
   tex->generateMipmap(wrapper.cmdBuf_);
-  immediate_->submit(wrapper);
+  stagingDevice_->submitCommandBuffer(wrapper);
 }
 
 lvk::Format lvk::VulkanContext::getFormat(TextureHandle handle) const {
@@ -6699,9 +9461,13 @@ lvk::ShaderModuleState lvk::VulkanContext::createShaderModuleFromSPIRV(const voi
 
   memcpy((void*)ci.pCode, spirv, numBytes);
 
+  Hasher hasher;
+  hasher.bytes(spirv, numBytes);
+
   return {
       .ci = ci,
       .pushConstantsSize = pushConstantsSize,
+      .spirvHash = hasher.get(),
   };
 }
 
@@ -7028,6 +9794,48 @@ double lvk::VulkanContext::getTimestampPeriodToMs() const {
   return double(getVkPhysicalDeviceProperties().limits.timestampPeriod) * 1e-6;
 }
 
+lvk::StagingStats lvk::VulkanContext::getStagingStats() const {
+  return stagingDevice_->getStats();
+}
+
+lvk::DescriptorSetStats lvk::VulkanContext::getDescriptorSetStats() const {
+  DescriptorSetStats stats = descriptorSetStats_;
+
+  for (const DescriptorSet& dset : DSets_) {
+    if (!dset.vkDSL) {
+      continue;
+    }
+    stats.numDescriptorSets++;
+    stats.numDescriptors += 2ull * dset.maxTextures + dset.maxSamplers + (has_KHR_acceleration_structure_ ? dset.maxAccelStructs : 0u);
+    if (dset.vkDSL == vkDSL_) {
+      stats.numDescriptors += dslNumYUVImages_;
+    }
+    stats.descriptorBufferSize += dset.descriptorBufferSize;
+  }
+
+  return stats;
+}
+
+lvk::CommandBufferStats lvk::VulkanContext::getCommandBufferStats() const {
+  CommandBufferStats stats = {};
+
+  for (const VulkanImmediateCommands* imm : {immediate_.get(), immediateCompute_.get(), immediateTransfer_.get()}) {
+    if (!imm) {
+      continue;
+    }
+    const CommandBufferStats s = imm->getStats();
+    stats.numCommandBuffers += s.numCommandBuffers;
+    stats.peakNumInFlight = std::max(stats.peakNumInFlight, s.peakNumInFlight);
+    stats.numGrowths += s.numGrowths;
+    stats.numStalls += s.numStalls;
+    stats.stallTimeMs += s.stallTimeMs;
+    stats.numStateCommandsEmitted += s.numStateCommandsEmitted;
+    stats.numStateCommandsSkipped += s.numStateCommandsSkipped;
+  }
+
+  return stats;
+}
+
 bool lvk::VulkanContext::getQueryPoolResults(QueryPoolHandle pool,
                                              uint32_t firstQuery,
                                              uint32_t queryCount,
@@ -7598,6 +10406,21 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
     vkMeshShaderFeatures_.pNext = vkFeatures10_.pNext;
     vkFeatures10_.pNext = &vkMeshShaderFeatures_;
   }
+  if (hasExtension(VK_EXT_MULTI_DRAW_EXTENSION_NAME, allDeviceExtensions)) {
+    addNextPhysicalDeviceProperties(&vkMultiDrawProperties_);
+  }
+  if (config_.enableDescriptorBuffer && hasExtension(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, allDeviceExtensions)) {
+    addNextPhysicalDeviceProperties(&vkDescriptorBufferProperties_);
+    // check whether push descriptors (used for input attachments) can be mixed with descriptor buffers
+    vkDescriptorBufferFeatures_.pNext = vkFeatures10_.pNext;
+    vkFeatures10_.pNext = &vkDescriptorBufferFeatures_;
+  }
+  if (config_.enableGraphicsPipelineLibrary && hasExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, allDeviceExtensions)) {
+    addNextPhysicalDeviceProperties(&vkGraphicsPipelineLibraryProperties_);
+    // check which features are supported before enabling them
+    vkGraphicsPipelineLibraryFeatures_.pNext = vkFeatures10_.pNext;
+    vkFeatures10_.pNext = &vkGraphicsPipelineLibraryFeatures_;
+  }
   if (hasExtension(VK_EXT_FRAGMENT_DENSITY_MAP_EXTENSION_NAME, allDeviceExtensions)) {
     addNextPhysicalDeviceProperties(&vkFragmentDensityMapProperties_);
     // check whether non-subsampled attachments are supported
@@ -7664,9 +10487,17 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
     return Result(Result::Code::RuntimeError, "VK_QUEUE_COMPUTE_BIT is not supported");
   }
 
+  // staging copies go to a separate transfer queue only if it does not share a family with the graphics or compute queue
+  deviceQueues_.transferQueueFamilyIndex = lvk::findQueueFamilyIndex(vkPhysicalDevice_, VK_QUEUE_TRANSFER_BIT);
+
+  if (deviceQueues_.transferQueueFamilyIndex == deviceQueues_.graphicsQueueFamilyIndex ||
+      deviceQueues_.transferQueueFamilyIndex == deviceQueues_.computeQueueFamilyIndex) {
+    deviceQueues_.transferQueueFamilyIndex = DeviceQueues::INVALID;
+  }
+
   const float queuePriority = 1.0f;
 
-  const VkDeviceQueueCreateInfo ciQueue[2] = {
+  VkDeviceQueueCreateInfo ciQueue[3] = {
       {
           .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
           .queueFamilyIndex = deviceQueues_.graphicsQueueFamilyIndex,
@@ -7680,7 +10511,16 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
           .pQueuePriorities = &queuePriority,
       },
   };
-  const uint32_t numQueues = ciQueue[0].queueFamilyIndex == ciQueue[1].queueFamilyIndex ? 1 : 2;
+  uint32_t numQueues = ciQueue[0].queueFamilyIndex == ciQueue[1].queueFamilyIndex ? 1 : 2;
+
+  if (deviceQueues_.transferQueueFamilyIndex != DeviceQueues::INVALID) {
+    ciQueue[numQueues++] = {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+        .queueFamilyIndex = deviceQueues_.transferQueueFamilyIndex,
+        .queueCount = 1,
+        .pQueuePriorities = &queuePriority,
+    };
+  }
 
   enabledDeviceExtensionNames_ = {
       VK_KHR_SWAPCHAIN_EXTENSION_NAME,
@@ -7857,6 +10697,19 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
       .primitiveFragmentShadingRateMeshShader = vkMeshShaderFeatures_.primitiveFragmentShadingRateMeshShader &&
                                                 vkFragmentShadingRateFeatures_.primitiveFragmentShadingRate,
   };
+  VkPhysicalDeviceMultiDrawFeaturesEXT multiDrawFeatures = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT,
+      .multiDraw = VK_TRUE,
+  };
+  VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+      .descriptorBuffer = VK_TRUE,
+      .descriptorBufferPushDescriptors = VK_TRUE,
+  };
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT graphicsPipelineLibraryFeatures = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT,
+      .graphicsPipelineLibrary = VK_TRUE,
+  };
   VkPhysicalDevicePresentModeFifoLatestReadyFeaturesKHR presentModeLatestReadyFeatures = {
       .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_MODE_FIFO_LATEST_READY_FEATURES_KHR,
       .presentModeFifoLatestReady = VK_TRUE,
@@ -7956,6 +10809,28 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
   }
   addOptionalExtension(VK_EXT_SHADER_TILE_IMAGE_EXTENSION_NAME, has_EXT_shader_tile_image, &shaderTileImageFeatures);
   addOptionalExtension(VK_EXT_MESH_SHADER_EXTENSION_NAME, has_EXT_mesh_shader_, &meshShaderFeatures);
+  addOptionalExtension(VK_EXT_MULTI_DRAW_EXTENSION_NAME, has_EXT_multi_draw_, &multiDrawFeatures);
+  if (config_.enableDescriptorBuffer) {
+    if (vkDescriptorBufferFeatures_.descriptorBuffer && vkDescriptorBufferFeatures_.descriptorBufferPushDescriptors) {
+      addOptionalExtension(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, has_EXT_descriptor_buffer_, &descriptorBufferFeatures);
+    }
+    if (!has_EXT_descriptor_buffer_) {
+      LLOGW("VK_EXT_descriptor_buffer is not supported (or lacks push descriptors) - using descriptor sets\n");
+    }
+  }
+  if (config_.enableGraphicsPipelineLibrary) {
+    // slow linking would only add to the cost of monolithic pipelines
+    if (vkGraphicsPipelineLibraryFeatures_.graphicsPipelineLibrary &&
+        vkGraphicsPipelineLibraryProperties_.graphicsPipelineLibraryFastLinking) {
+      addOptionalExtensions(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME,
+                            VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME,
+                            has_EXT_graphics_pipeline_library_,
+                            &graphicsPipelineLibraryFeatures);
+    }
+    if (!has_EXT_graphics_pipeline_library_) {
+      LLOGW("VK_EXT_graphics_pipeline_library is not supported (or cannot link fast) - using monolithic pipelines\n");
+    }
+  }
   // VUID-VkDeviceCreateInfo-fragmentDensityMap-04481/04482/04483: the FSR is mutually exclusive with FDM, so enable only one of them
   if (!config_.enableFragmentShadingRate ||
       !addOptionalExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME, has_KHR_fragment_shading_rate_, &fragmentShadingRateFeatures)) {
@@ -7967,7 +10842,7 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
       VK_KHR_PRESENT_MODE_FIFO_LATEST_READY_EXTENSION_NAME, has_KHR_present_mode_fifo_latest_ready_, &presentModeLatestReadyFeatures);
 
   if (has_EXT_host_image_copy_) {
-    // query VK_EXT_host_image_copy properties (copy dst layouts + memory-type requirements)
+    // query VK_EXT_host_image_copy properties (copy src/dst layouts + memory-type requirements)
     VkPhysicalDeviceHostImageCopyProperties props = {
         .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES,
     };
@@ -7976,14 +10851,18 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
         .pNext = &props,
     };
     vkGetPhysicalDeviceProperties2(vkPhysicalDevice_, &props2);
+    std::vector<VkImageLayout> srcLayouts(props.copySrcLayoutCount);
     std::vector<VkImageLayout> dstLayouts(props.copyDstLayoutCount);
-    props.copySrcLayoutCount = 0;
+    props.pCopySrcLayouts = srcLayouts.data();
     props.pCopyDstLayouts = dstLayouts.data();
     vkGetPhysicalDeviceProperties2(vkPhysicalDevice_, &props2);
 
-    // imageData2D() copies into SHADER_READ_ONLY_OPTIMAL, so this is the only destination layout we ever need
+    // imageData2D() and imageData3D() copy into SHADER_READ_ONLY_OPTIMAL, so this is the only destination layout we ever need
     hostImageCopyToShaderReadOnly_ =
         std::find(dstLayouts.begin(), dstLayouts.end(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) != dstLayouts.end();
+    // getImageData() reads the uploaded images back in the same layout
+    hostImageCopyFromShaderReadOnly_ =
+        std::find(srcLayouts.begin(), srcLayouts.end(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) != srcLayouts.end();
     hostImageCopyIdenticalMemoryTypeRequirements_ = props.identicalMemoryTypeRequirements == VK_TRUE;
 
     // device-local memory type mask, used to check whether HOST_TRANSFER images stay device-local
@@ -8198,18 +11077,62 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
         vkDevice_, deviceQueues_.computeQueueFamilyIndex, has_EXT_device_fault_, "VulkanContext::immediateCompute_");
   }
 
+  if (deviceQueues_.transferQueueFamilyIndex != DeviceQueues::INVALID) {
+    vkGetDeviceQueue(vkDevice_, deviceQueues_.transferQueueFamilyIndex, 0, &deviceQueues_.transferQueue);
+    immediateTransfer_ = std::make_unique<lvk::VulkanImmediateCommands>(
+        vkDevice_, deviceQueues_.transferQueueFamilyIndex, has_EXT_device_fault_, "VulkanContext::immediateTransfer_");
+  }
+
+  secondaryCommands_ = std::make_unique<lvk::VulkanSecondaryCommands>(*this, config_.maxRecordingThreads);
+
   // create Vulkan pipeline cache
   {
+    const std::vector<uint8_t> cacheFileData = config_.pipelineCacheDirectory ? loadPipelineCacheFile() : std::vector<uint8_t>();
+    const void* data = cacheFileData.empty() ? config_.pipelineCacheData : cacheFileData.data();
+    size_t size = cacheFileData.empty() ? config_.pipelineCacheDataSize : cacheFileData.size();
+    if (size && !isPipelineCacheCompatible(data, size, getVkPhysicalDeviceProperties())) {
+      LLOGW("Ignoring pipeline cache data created by a different device or driver\n");
+      size = 0;
+    }
     const VkPipelineCacheCreateInfo ci = {
         VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
         nullptr,
         VkPipelineCacheCreateFlags(0),
-        config_.pipelineCacheDataSize,
-        config_.pipelineCacheData,
+        size,
+        size ? data : nullptr,
     };
     vkCreatePipelineCache(vkDevice_, &ci, nullptr, &pipelineCache_);
   }
 
+  for (uint32_t i = 0; i != config_.numPipelineCompileThreads; i++) {
+    pimpl_->pipelineCompileThreads_.emplace_back([impl = pimpl_.get()]() {
+      LVK_PROFILER_THREAD("PipelineCompileThread");
+      for (;;) {
+        RenderPipelineCompileJob* job = nullptr;
+        std::packaged_task<void()> saveTask;
+        {
+          std::unique_lock lock(impl->pipelineCompileMutex_);
+          impl->pipelineCompileCondition_.wait(lock, [impl]() {
+            return impl->pipelineCompileExit_ || !impl->pipelineCompileQueue_.empty() || impl->pipelineCacheSaveTask_.valid();
+          });
+          if (impl->pipelineCacheSaveTask_.valid()) {
+            saveTask = std::move(impl->pipelineCacheSaveTask_);
+          } else if (impl->pipelineCompileQueue_.empty()) {
+            return;
+          } else {
+            job = impl->pipelineCompileQueue_.front();
+            impl->pipelineCompileQueue_.pop_front();
+          }
+        }
+        if (saveTask.valid()) {
+          saveTask();
+          continue;
+        }
+        job->task();
+      }
+    });
+  }
+
   if (LVK_VULKAN_USE_VMA) {
     pimpl_->vma_ = lvk::createVmaAllocator(
         vkPhysicalDevice_, vkDevice_, vkInstance_, apiVersion > VK_API_VERSION_1_3 ? VK_API_VERSION_1_3 : apiVersion);
@@ -8329,7 +11252,9 @@ lvk::Result lvk::VulkanContext::initContext(const HWDeviceDesc& desc) {
     const VkPhysicalDeviceLimits& limits = this->getVkPhysicalDeviceProperties().limits;
     const VkDescriptorSetLayoutCreateInfo dslci = {
         .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
-        .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT,
+        // all set layouts of a pipeline must agree on VK_EXT_descriptor_buffer
+        .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT |
+                 (has_EXT_descriptor_buffer_ ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0u),
         .bindingCount = std::min((uint32_t)LVK_MAX_COLOR_ATTACHMENTS, limits.maxPerStageDescriptorInputAttachments),
         .pBindings = bindings,
     };
@@ -8371,21 +11296,9 @@ lvk::Result lvk::VulkanContext::initSwapchain(uint32_t width, uint32_t height) {
   return swapchain_ ? Result() : Result(Result::Code::RuntimeError, "Failed to create swapchain");
 }
 
-lvk::Result lvk::VulkanContext::growDescriptorPool(VulkanContext::DescriptorSet& dset,
-                                                   uint32_t maxTextures,
-                                                   uint32_t maxSamplers,
-                                                   uint32_t maxAccelStructs) {
-  if (maxTextures == dset.maxTextures && maxSamplers == dset.maxSamplers && maxAccelStructs == dset.maxAccelStructs &&
-      !awaitingNewImmutableSamplers_) {
-    return Result();
-  }
-
-  dset.maxTextures = maxTextures;
-  dset.maxSamplers = maxSamplers;
-  dset.maxAccelStructs = maxAccelStructs;
-
+lvk::Result lvk::VulkanContext::createDescriptorSetLayout(uint32_t maxTextures, uint32_t maxSamplers, uint32_t maxAccelStructs) {
 #if LVK_VULKAN_PRINT_COMMANDS
-  LLOGL("growDescriptorPool(%u, %u)\n", maxTextures, maxSamplers);
+  LLOGL("createDescriptorSetLayout(%u, %u)\n", maxTextures, maxSamplers);
 #endif // LVK_VULKAN_PRINT_COMMANDS
 
   if (!LVK_VERIFY(maxTextures <= vkPhysicalDeviceVulkan12Properties_.maxDescriptorSetUpdateAfterBindSampledImages)) {
@@ -8398,18 +11311,20 @@ lvk::Result lvk::VulkanContext::growDescriptorPool(VulkanContext::DescriptorSet&
     LLOGW("Max Samplers exceeded %u (max %u)", maxSamplers, vkPhysicalDeviceVulkan12Properties_.maxDescriptorSetUpdateAfterBindSamplers);
   }
 
-  if (dset.vkDSL != VK_NULL_HANDLE) {
-    deferredTask(
-        std::packaged_task<void()>([device = vkDevice_, dsl = dset.vkDSL]() { vkDestroyDescriptorSetLayout(device, dsl, nullptr); }));
-  }
-  if (dset.vkDPool != VK_NULL_HANDLE) {
-    deferredTask(std::packaged_task<void()>([device = vkDevice_, dp = dset.vkDPool]() { vkDestroyDescriptorPool(device, dp, nullptr); }));
+  if (vkDSL_ != VK_NULL_HANDLE) {
+    deferredTask(std::packaged_task<void()>([device = vkDevice_, dsl = vkDSL_]() { vkDestroyDescriptorSetLayout(device, dsl, nullptr); }));
   }
 
   VkSampler firstYcbcrSampler = VK_NULL_HANDLE;
 
-  // check if we have any YUV images
+  // check if we have any YUV images (immutable Ycbcr samplers are not supported with VK_EXT_descriptor_buffer)
   for (const VulkanImage& img : texturesPool_.objects_) {
+    if (has_EXT_descriptor_buffer_) {
+      if (pimpl_->numYcbcrSamplers_) {
+        LLOGW("YUV textures are not supported with ContextConfig::enableDescriptorBuffer\n");
+      }
+      break;
+    }
     // multisampled images cannot be directly accessed from shaders
     const bool isTextureAvailable = (img.vkSamples_ & VK_SAMPLE_COUNT_1_BIT) == VK_SAMPLE_COUNT_1_BIT;
     const bool isYUVImage = isTextureAvailable && img.isSampledImage() && lvk::getNumImagePlanes(img.vkImageFormat_) > 1;
@@ -8462,8 +11377,11 @@ lvk::Result lvk::VulkanContext::growDescriptorPool(VulkanContext::DescriptorSet&
                          immutableSamplersData),
       lvk::getDSLBinding(kBinding_AccelerationStructures, VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, maxAccelStructs, stageFlags),
   };
-  const uint32_t flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
-                         VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+  // descriptor buffers are plain memory written by the host, update-after-bind does not apply to them
+  const uint32_t flags = has_EXT_descriptor_buffer_ ? VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+                                                    : VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                                                          VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+                                                          VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
   VkDescriptorBindingFlags bindingFlags[kBinding_NumBindings];
   for (int i = 0; i < kBinding_NumBindings; ++i) {
     bindingFlags[i] = flags;
@@ -8476,30 +11394,86 @@ lvk::Result lvk::VulkanContext::growDescriptorPool(VulkanContext::DescriptorSet&
   const VkDescriptorSetLayoutCreateInfo dslci = {
       .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
       .pNext = &setLayoutBindingFlagsCI,
-      .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+      .flags = has_EXT_descriptor_buffer_ ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT
+                                          : VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
       .bindingCount = uint32_t(has_KHR_acceleration_structure_ ? kBinding_NumBindings : kBinding_NumBindings - 1),
       .pBindings = bindings,
   };
-  VK_ASSERT(vkCreateDescriptorSetLayout(vkDevice_, &dslci, nullptr, &dset.vkDSL));
+  VK_ASSERT(vkCreateDescriptorSetLayout(vkDevice_, &dslci, nullptr, &vkDSL_));
   VK_ASSERT(lvk::setDebugObjectName(
-      vkDevice_, VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, (uint64_t)dset.vkDSL, "Descriptor Set Layout: VulkanContext::vkDSL"));
+      vkDevice_, VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, (uint64_t)vkDSL_, "Descriptor Set Layout: VulkanContext::vkDSL_"));
+
+  dslMaxTextures_ = maxTextures;
+  dslMaxSamplers_ = maxSamplers;
+  dslMaxAccelStructs_ = maxAccelStructs;
+  dslNumYUVImages_ = bindings[kBinding_YUVImages].descriptorCount;
+  dslImmutableSamplers_ = std::move(immutableSamplers);
+
+  descriptorSetStats_.numLayoutChanges++;
+
+  awaitingNewImmutableSamplers_ = false;
+
+  return Result();
+}
+
+lvk::Result lvk::VulkanContext::growDescriptorPool(VulkanContext::DescriptorSet& dset,
+                                                   uint32_t maxTextures,
+                                                   uint32_t maxSamplers,
+                                                   uint32_t maxAccelStructs) {
+  if (has_EXT_descriptor_buffer_) {
+    // no immutable samplers with descriptor buffers (see createDescriptorSetLayout())
+    awaitingNewImmutableSamplers_ = false;
+  }
+
+  // the layout is shared by all descriptor sets, so pipelines are rebuilt only when it has to grow (or gets new immutable samplers)
+  if (vkDSL_ == VK_NULL_HANDLE || maxTextures != dslMaxTextures_ || maxSamplers != dslMaxSamplers_ ||
+      maxAccelStructs != dslMaxAccelStructs_ || awaitingNewImmutableSamplers_) {
+    const Result result = createDescriptorSetLayout(maxTextures, maxSamplers, maxAccelStructs);
+    if (!result.isOk()) {
+      return result;
+    }
+  }
+
+  if (dset.vkDSL == vkDSL_) {
+    // this descriptor set has been allocated with the current layout
+    return Result();
+  }
+
+  dset.vkDSL = vkDSL_;
+  dset.maxTextures = dslMaxTextures_;
+  dset.maxSamplers = dslMaxSamplers_;
+  dset.maxAccelStructs = dslMaxAccelStructs_;
+
+  if (dset.vkDPool != VK_NULL_HANDLE) {
+    deferredTask(std::packaged_task<void()>([device = vkDevice_, dp = dset.vkDPool]() { vkDestroyDescriptorPool(device, dp, nullptr); }));
+  }
+
+  if (has_EXT_descriptor_buffer_) {
+    static_assert(LVK_ARRAY_NUM_ELEMENTS(dset.bindingOffsets) == kBinding_NumBindings);
+    vkGetDescriptorSetLayoutSizeEXT(vkDevice_, vkDSL_, &dset.descriptorBufferSize);
+    for (uint32_t i = 0; i != uint32_t(has_KHR_acceleration_structure_ ? kBinding_NumBindings : kBinding_NumBindings - 1); i++) {
+      vkGetDescriptorSetLayoutBindingOffsetEXT(vkDevice_, vkDSL_, i, &dset.bindingOffsets[i]);
+    }
+    // the layout has changed, so all descriptors are going to be rewritten
+    return createDescriptorBuffer(dset, false);
+  }
 
   {
     // create default descriptor pool and allocate 1 descriptor set
     VkDescriptorPoolSize poolSizes[kBinding_NumBindings] = {
-        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, maxTextures},
-        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_SAMPLER, maxSamplers},
-        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, maxTextures},
+        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, dset.maxTextures},
+        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_SAMPLER, dset.maxSamplers},
+        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, dset.maxTextures},
     };
     uint32_t numPoolSizes = 3;
-    if (!immutableSamplers.empty()) {
+    if (dslNumYUVImages_) {
       poolSizes[numPoolSizes++] = VkDescriptorPoolSize{
           VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-          pimpl_->maxCombinedImageSamplerDescriptorCount_ * (workaround_noYcbcrSamplerArray_ ? 1u : maxTextures),
+          pimpl_->maxCombinedImageSamplerDescriptorCount_ * dslNumYUVImages_,
       };
     }
     if (has_KHR_acceleration_structure_) {
-      poolSizes[numPoolSizes++] = VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, maxAccelStructs};
+      poolSizes[numPoolSizes++] = VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, dset.maxAccelStructs};
     }
     LVK_ASSERT(numPoolSizes <= kBinding_NumBindings);
     const VkDescriptorPoolCreateInfo ci = {
@@ -8519,11 +11493,147 @@ lvk::Result lvk::VulkanContext::growDescriptorPool(VulkanContext::DescriptorSet&
     VK_ASSERT_RETURN(vkAllocateDescriptorSets(vkDevice_, &ai, &dset.vkDSet));
   }
 
-  awaitingNewImmutableSamplers_ = false;
+  return Result();
+}
+
+lvk::Result lvk::VulkanContext::createDescriptorBuffer(VulkanContext::DescriptorSet& dset, bool copyContents) {
+  LVK_PROFILER_FUNCTION_COLOR(LVK_PROFILER_COLOR_CREATE);
+
+  LVK_ASSERT(has_EXT_descriptor_buffer_);
+  LVK_ASSERT(dset.descriptorBufferSize);
+
+  Result result;
+  const BufferHandle handle = createBuffer(dset.descriptorBufferSize,
+                                           getDescriptorBufferUsageFlags(vkDescriptorBufferProperties_),
+                                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                           &result,
+                                           "Buffer: VulkanContext::descriptorBuffer");
+  if (!LVK_VERIFY(result.isOk())) {
+    return result;
+  }
+
+  const lvk::VulkanBuffer* buf = buffersPool_.get(handle);
+
+  LVK_ASSERT_MSG((buf->vkDeviceAddress_ % vkDescriptorBufferProperties_.descriptorBufferOffsetAlignment) == 0,
+                 "The descriptor buffer address is not aligned to descriptorBufferOffsetAlignment");
+
+  const lvk::VulkanBuffer* oldBuf = buffersPool_.get(dset.descriptorBuffer);
+
+  if (copyContents && oldBuf && oldBuf->bufferSize_ == buf->bufferSize_) {
+    memcpy(buf->mappedPtr_, oldBuf->mappedPtr_, buf->bufferSize_);
+  } else {
+    memset(buf->mappedPtr_, 0, buf->bufferSize_);
+  }
+  if (!buf->isCoherentMemory_) {
+    buf->flushMappedMemory(*this, 0, buf->bufferSize_);
+  }
+
+  // the old buffer might still be read by the GPU - its destruction is deferred
+  destroy(dset.descriptorBuffer);
+
+  dset.descriptorBuffer = handle;
+  dset.descriptorBufferAddress = buf->vkDeviceAddress_;
+
+  // command lists recorded earlier have the old buffer address baked in
+  descriptorSetsGeneration_++;
 
   return Result();
 }
 
+void lvk::VulkanContext::writeDescriptors(const VulkanContext::DescriptorSet& dset,
+                                          const VkWriteDescriptorSet* writes,
+                                          uint32_t numWrites) {
+  if (!numWrites) {
+    return;
+  }
+
+#if LVK_VULKAN_PRINT_COMMANDS
+  LLOGL("vkUpdateDescriptorSets(%u)\n", numWrites);
+#endif // LVK_VULKAN_PRINT_COMMANDS
+
+  if (!has_EXT_descriptor_buffer_) {
+    LVK_PROFILER_ZONE("vkUpdateDescriptorSets()", LVK_PROFILER_COLOR_PRESENT);
+    vkUpdateDescriptorSets(vkDevice_, numWrites, writes, 0, nullptr);
+    LVK_PROFILER_ZONE_END();
+    return;
+  }
+
+  LVK_PROFILER_ZONE("vkGetDescriptorEXT()", LVK_PROFILER_COLOR_PRESENT);
+
+  const lvk::VulkanBuffer* buf = buffersPool_.get(dset.descriptorBuffer);
+
+  if (!LVK_VERIFY(buf && buf->mappedPtr_)) {
+    return;
+  }
+
+  const VkPhysicalDeviceDescriptorBufferPropertiesEXT& props = vkDescriptorBufferProperties_;
+
+  // translate VkWriteDescriptorSet into descriptors written directly into the mapped buffer
+  for (uint32_t w = 0; w != numWrites; w++) {
+    const VkWriteDescriptorSet& write = writes[w];
+
+    size_t size = 0;
+
+    switch (write.descriptorType) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+      size = props.samplerDescriptorSize;
+      break;
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+      size = props.sampledImageDescriptorSize;
+      break;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+      size = props.storageImageDescriptorSize;
+      break;
+    case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+      size = props.accelerationStructureDescriptorSize;
+      break;
+    default:
+      // no YUV images here (see growDescriptorPool())
+      continue;
+    }
+
+    uint8_t* dst = (uint8_t*)buf->mappedPtr_ + dset.bindingOffsets[write.dstBinding];
+
+    for (uint32_t i = 0; i != write.descriptorCount; i++) {
+      VkDescriptorGetInfoEXT info = {
+          .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+          .type = write.descriptorType,
+      };
+      switch (write.descriptorType) {
+      case VK_DESCRIPTOR_TYPE_SAMPLER:
+        info.data.pSampler = &write.pImageInfo[i].sampler;
+        break;
+      case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        info.data.pSampledImage = &write.pImageInfo[i];
+        break;
+      case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        info.data.pStorageImage = &write.pImageInfo[i];
+        break;
+      default: {
+        const VkWriteDescriptorSetAccelerationStructureKHR* as = (const VkWriteDescriptorSetAccelerationStructureKHR*)write.pNext;
+        if (!as->pAccelerationStructures[i]) {
+          // no TLAS yet - leave the slot empty
+          continue;
+        }
+        const VkAccelerationStructureDeviceAddressInfoKHR ai = {
+            .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR,
+            .accelerationStructure = as->pAccelerationStructures[i],
+        };
+        info.data.accelerationStructure = vkGetAccelerationStructureDeviceAddressKHR(vkDevice_, &ai);
+        break;
+      }
+      }
+      vkGetDescriptorEXT(vkDevice_, &info, size, dst + (write.dstArrayElement + i) * size);
+    }
+  }
+
+  if (!buf->isCoherentMemory_) {
+    buf->flushMappedMemory(*this, 0, buf->bufferSize_);
+  }
+
+  LVK_PROFILER_ZONE_END();
+}
+
 lvk::BufferHandle lvk::VulkanContext::createBuffer(VkDeviceSize bufferSize,
                                                    VkBufferUsageFlags usageFlags,
                                                    VkMemoryPropertyFlags memFlags,
@@ -8649,7 +11759,35 @@ lvk::BufferHandle lvk::VulkanContext::createBuffer(VkDeviceSize bufferSize,
 
 void lvk::VulkanContext::bindDefaultDescriptorSets(VkCommandBuffer cmdBuf, VkPipelineBindPoint bindPoint, VkPipelineLayout layout) const {
   LVK_PROFILER_FUNCTION();
-  vkCmdBindDescriptorSets(cmdBuf, bindPoint, layout, 0, 1, &DSets_[lastUpdatedDSet_].vkDSet, 0, nullptr);
+
+  const DescriptorSet& dset = DSets_[lastUpdatedDSet_];
+
+  if (has_EXT_descriptor_buffer_) {
+    const VkDescriptorBufferBindingInfoEXT bindingInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+        .address = dset.descriptorBufferAddress,
+        .usage = getDescriptorBufferUsageFlags(vkDescriptorBufferProperties_),
+    };
+    const uint32_t bufferIndex = 0;
+    const VkDeviceSize offset = 0;
+    vkCmdBindDescriptorBuffersEXT(cmdBuf, 1, &bindingInfo);
+    vkCmdSetDescriptorBufferOffsetsEXT(cmdBuf, bindPoint, layout, 0, 1, &bufferIndex, &offset);
+    return;
+  }
+
+  vkCmdBindDescriptorSets(cmdBuf, bindPoint, layout, 0, 1, &dset.vkDSet, 0, nullptr);
+}
+
+bool lvk::VulkanContext::isBoundByRecordingCommandBuffers(const VulkanContext::DescriptorSet& dset) const {
+  for (const std::deque<lvk::CommandBuffer>* slots : {&pimpl_->commandBuffers_, &pimpl_->computeCommandBuffers_}) {
+    for (const lvk::CommandBuffer& cmdBuffer : *slots) {
+      // acquired before `dset` stopped being current (secondary buffers and command lists are executed by these)
+      if (cmdBuffer.ctx_ && cmdBuffer.acquiredDescriptorSetsGeneration_ <= dset.retiredGeneration) {
+        return true;
+      }
+    }
+  }
+  return false;
 }
 
 void lvk::VulkanContext::checkAndUpdateDescriptorSets() {
@@ -8661,31 +11799,165 @@ void lvk::VulkanContext::checkAndUpdateDescriptorSets() {
   // newly created resources can be used immediately - make sure they are put into descriptor sets
   LVK_PROFILER_FUNCTION();
 
-  // update Vulkan descriptor set here
+  // make sure the guard values are always there
+  LVK_ASSERT(texturesPool_.numObjects() >= 1);
+  LVK_ASSERT(samplersPool_.numObjects() >= 1);
+
+  const bool hasYcbcrSamplers = pimpl_->numYcbcrSamplers_ > 0;
+
+  // use dummies to avoid sparse arrays
+  const VkImageView dummyImageView = texturesPool_.objects_[0].imageView_;
+  const VkSampler dummySampler = samplersPool_.objects_[0];
+
+  struct TextureDescriptors {
+    VkDescriptorImageInfo sampled;
+    VkDescriptorImageInfo storage;
+    VkDescriptorImageInfo yuv;
+  };
+
+  auto getTextureDescriptors = [dummyImageView, dummySampler](const VulkanImage& img) -> TextureDescriptors {
+    const VkImageView view = img.imageView_;
+    const VkImageView storageView = img.imageViewStorage_ ? img.imageViewStorage_ : view;
+    // multisampled images cannot be directly accessed from shaders
+    const bool isTextureAvailable = (img.vkSamples_ & VK_SAMPLE_COUNT_1_BIT) == VK_SAMPLE_COUNT_1_BIT;
+    const bool isYUVImage = isTextureAvailable && img.isSampledImage() && lvk::getNumImagePlanes(img.vkImageFormat_) > 1;
+    const bool isSampledImage = isTextureAvailable && img.isSampledImage() && !isYUVImage;
+    const bool isStorageImage = isTextureAvailable && img.isStorageImage();
+    return {
+        .sampled = {.imageView = isSampledImage ? view : dummyImageView, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL},
+        .storage = {.imageView = isStorageImage ? storageView : dummyImageView, .imageLayout = VK_IMAGE_LAYOUT_GENERAL},
+        // the sampler will be replaced by immutable samplers from VkPipeline
+        .yuv = {.sampler = dummySampler,
+                .imageView = isYUVImage ? view : dummyImageView,
+                .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL},
+    };
+  };
+
+  auto getSamplerDescriptor = [dummySampler](VkSampler sampler) -> VkDescriptorImageInfo {
+    return {.sampler = sampler ? sampler : dummySampler, .imageLayout = VK_IMAGE_LAYOUT_UNDEFINED};
+  };
+
+  // the current descriptor set is bound by everything submitted since it became current and by command buffers still being recorded
+  const bool isInFlight = !immediate_->isReady(immediate_->getLastSubmitHandle()) ||
+                          (immediateCompute_ && !immediateCompute_->isReady(immediateCompute_->getLastSubmitHandle()));
+  const bool isInUse = isInFlight || isBoundByRecordingCommandBuffers(DSets_[lastUpdatedDSet_]);
+
+  // 0. Try to write only the changed slots into the current descriptor set. This is possible when the set is large enough and
+  // its layout stays the same. Slots which were never written before cannot be in use by the GPU, so they can be written anytime
+  // (update-after-bind). Rewriting previously used slots requires the set to be idle and not bound by any unsubmitted command buffer.
+  if (DescriptorSet& dset = DSets_[lastUpdatedDSet_]; dset.vkDSL && !awaitingNewImmutableSamplers_ && !dirtyAccelStructs_ &&
+                                                       !(hasYcbcrSamplers && workaround_noYcbcrSamplerArray_) &&
+                                                       texturesPool_.objects_.size() <= dset.maxTextures &&
+                                                       samplersPool_.objects_.size() <= dset.maxSamplers) {
+    std::sort(dirtyTextures_.begin(), dirtyTextures_.end());
+    dirtyTextures_.erase(std::unique(dirtyTextures_.begin(), dirtyTextures_.end()), dirtyTextures_.end());
+    std::sort(dirtySamplers_.begin(), dirtySamplers_.end());
+    dirtySamplers_.erase(std::unique(dirtySamplers_.begin(), dirtySamplers_.end()), dirtySamplers_.end());
+
+    const bool rewritesUsedSlots = (!dirtyTextures_.empty() && dirtyTextures_.front() < dset.numTextures) ||
+                                   (!dirtySamplers_.empty() && dirtySamplers_.front() < dset.numSamplers);
+
+    if (!rewritesUsedSlots || !isInUse || has_EXT_descriptor_buffer_) {
+      if (has_EXT_descriptor_buffer_ && rewritesUsedSlots && isInUse) {
+        // the GPU or unsubmitted command buffers may still read the old descriptors - continue in a fresh copy of the descriptor buffer
+        createDescriptorBuffer(dset, true);
+      }
+      std::vector<VkDescriptorImageInfo> infos;
+      std::vector<VkWriteDescriptorSet> writes;
+      const size_t numInfosPerTexture = hasYcbcrSamplers ? 3 : 2;
+      // VkWriteDescriptorSet keeps pointers into `infos`
+      infos.reserve(numInfosPerTexture * dirtyTextures_.size() + dirtySamplers_.size());
+      writes.reserve(infos.capacity());
+
+      auto addWrite = [&infos, &writes, &dset](uint32_t binding, uint32_t index, VkDescriptorType type, const VkDescriptorImageInfo& info) {
+        infos.push_back(info);
+        writes.push_back(VkWriteDescriptorSet{
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = dset.vkDSet,
+            .dstBinding = binding,
+            .dstArrayElement = index,
+            .descriptorCount = 1,
+            .descriptorType = type,
+            .pImageInfo = &infos.back(),
+        });
+      };
+
+      for (uint32_t index : dirtyTextures_) {
+        if (index >= texturesPool_.objects_.size()) {
+          continue;
+        }
+        const TextureDescriptors d = getTextureDescriptors(texturesPool_.objects_[index]);
+        addWrite(kBinding_Textures, index, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, d.sampled);
+        addWrite(kBinding_StorageImages, index, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, d.storage);
+        if (hasYcbcrSamplers) {
+          addWrite(kBinding_YUVImages, index, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, d.yuv);
+        }
+        dset.numTextures = std::max(dset.numTextures, index + 1);
+      }
+      for (uint32_t index : dirtySamplers_) {
+        if (index >= samplersPool_.objects_.size()) {
+          continue;
+        }
+        addWrite(kBinding_Samplers, index, VK_DESCRIPTOR_TYPE_SAMPLER, getSamplerDescriptor(samplersPool_.objects_[index]));
+        dset.numSamplers = std::max(dset.numSamplers, index + 1);
+      }
+
+      writeDescriptors(dset, writes.data(), (uint32_t)writes.size());
+
+      dirtyTextures_.clear();
+      dirtySamplers_.clear();
+      awaitingCreation_ = false;
+      return;
+    }
+  }
 
-  lastUpdatedDSet_ = (lastUpdatedDSet_ + 1) % DSets_.size();
+  // update Vulkan descriptor set here
 
-  if (const DescriptorSet& dset = DSets_[lastUpdatedDSet_]; dset.vkDSet) {
-    // we can't reuse a dset that's either waiting to be submitted in a draw call
-    // (which happens when textures are created mid-frame) or is still being processed
-    if (dset.handle_.empty() || !immediate_->isReady(dset.handle_)) {
-      // add a new empty dset to be populated right away
-      lastUpdatedDSet_ = DSets_.size();
-      DSets_.push_back({});
+  // VK_EXT_descriptor_buffer uses a single set; its buffer is replaced instead
+  if (!has_EXT_descriptor_buffer_) {
+    DSets_[lastUpdatedDSet_].retiredGeneration = descriptorSetsGeneration_;
+    lastUpdatedDSet_ = (lastUpdatedDSet_ + 1) % DSets_.size();
+
+    if (const DescriptorSet& dset = DSets_[lastUpdatedDSet_]; dset.vkDSet) {
+      const SubmitHandle handle = dset.handle_;
+      const bool isCompute = immediateCompute_ && !handle.empty() && handle.queueFamilyIndex_ == deviceQueues_.computeQueueFamilyIndex;
+      // we can't reuse a dset that's either waiting to be submitted in a draw call
+      // (which happens when textures are created mid-frame) or is still being processed
+      const bool isRecording = handle.empty() || isBoundByRecordingCommandBuffers(dset);
+      if (isRecording || !(isCompute ? immediateCompute_ : immediate_)->isReady(handle)) {
+        const size_t maxSets = std::max(config_.maxDescriptorSets, 2u);
+        // waiting for `handle` does not help while an unsubmitted command buffer still references the set
+        if (DSets_.size() < maxSets || isRecording) {
+          if (DSets_.size() >= maxSets) {
+            LLOGW("All %u descriptor sets are used by command buffers which are not submitted yet\n", (uint32_t)DSets_.size());
+          }
+          // add a new empty dset to be populated right away; inserting it here keeps the oldest set next in the ring
+          DSets_.insert(DSets_.begin() + lastUpdatedDSet_, DescriptorSet{});
+        } else {
+          // the ring is full - recycle the oldest set (and its descriptor pool) once the GPU is done with it
+          LVK_PROFILER_ZONE("Waiting for descriptor set...", LVK_PROFILER_COLOR_WAIT);
+          const auto startTime = std::chrono::steady_clock::now();
+          wait(handle);
+          descriptorSetStats_.numStalls++;
+          descriptorSetStats_.stallTimeMs +=
+              std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+          LVK_PROFILER_ZONE_END();
+        }
+      }
     }
   }
 
   DescriptorSet& dset = DSets_[lastUpdatedDSet_];
 
   dset.handle_ = {};
+  dset.retiredGeneration = UINT64_MAX;
 
-  // make sure the guard values are always there
-  LVK_ASSERT(texturesPool_.numObjects() >= 1);
-  LVK_ASSERT(samplersPool_.numObjects() >= 1);
+  descriptorSetsGeneration_++;
 
-  uint32_t newMaxTextures = std::max(dset.maxTextures, 16u);
-  uint32_t newMaxSamplers = std::max(dset.maxSamplers, 16u);
-  uint32_t newMaxAccelStructs = std::max(dset.maxAccelStructs, workaround_fixedSizeAccelStructArray_ ? 128u : 1u);
+  // start from the capacity reserved in ContextConfig; the shared layout never shrinks
+  uint32_t newMaxTextures = std::max({dslMaxTextures_, config_.reservedBindlessTextures, 16u});
+  uint32_t newMaxSamplers = std::max({dslMaxSamplers_, config_.reservedBindlessSamplers, 16u});
+  uint32_t newMaxAccelStructs = std::max(dslMaxAccelStructs_, workaround_fixedSizeAccelStructArray_ ? 128u : 1u);
 
   while (texturesPool_.objects_.size() > newMaxTextures) {
     newMaxTextures *= 2;
@@ -8696,8 +11968,15 @@ void lvk::VulkanContext::checkAndUpdateDescriptorSets() {
   while (accelStructuresPool_.objects_.size() > newMaxAccelStructs) {
     newMaxAccelStructs *= 2;
   }
+  const BufferHandle oldDescriptorBuffer = dset.descriptorBuffer;
+
   growDescriptorPool(dset, newMaxTextures, newMaxSamplers, newMaxAccelStructs);
 
+  if (has_EXT_descriptor_buffer_ && dset.descriptorBuffer == oldDescriptorBuffer && isInUse) {
+    // everything is rewritten below while the GPU or unsubmitted command buffers may still read the current buffer
+    createDescriptorBuffer(dset, false);
+  }
+
   // 1. Sampled and storage images
   std::vector<VkDescriptorImageInfo> infoSampledImages;
   std::vector<VkDescriptorImageInfo> infoStorageImages;
@@ -8706,42 +11985,18 @@ void lvk::VulkanContext::checkAndUpdateDescriptorSets() {
   infoSampledImages.reserve(texturesPool_.numObjects());
   infoStorageImages.reserve(texturesPool_.numObjects());
 
-  const bool hasYcbcrSamplers = pimpl_->numYcbcrSamplers_ > 0;
-
   if (hasYcbcrSamplers) {
     infoYUVImages.reserve(texturesPool_.numObjects());
   }
 
-  // use dummies to avoid sparse arrays
-  VkImageView dummyImageView = texturesPool_.objects_[0].imageView_;
-  VkSampler dummySampler = samplersPool_.objects_[0];
-
   for (const VulkanImage& img : texturesPool_.objects_) {
-    const VkImageView view = img.imageView_;
-    const VkImageView storageView = img.imageViewStorage_ ? img.imageViewStorage_ : view;
-    // multisampled images cannot be directly accessed from shaders
-    const bool isTextureAvailable = (img.vkSamples_ & VK_SAMPLE_COUNT_1_BIT) == VK_SAMPLE_COUNT_1_BIT;
-    const bool isYUVImage = isTextureAvailable && img.isSampledImage() && lvk::getNumImagePlanes(img.vkImageFormat_) > 1;
-    const bool isSampledImage = isTextureAvailable && img.isSampledImage() && !isYUVImage;
-    const bool isStorageImage = isTextureAvailable && img.isStorageImage();
-    infoSampledImages.push_back(VkDescriptorImageInfo{
-        .sampler = VK_NULL_HANDLE,
-        .imageView = isSampledImage ? view : dummyImageView,
-        .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-    });
+    const TextureDescriptors d = getTextureDescriptors(img);
+    infoSampledImages.push_back(d.sampled);
     LVK_ASSERT(infoSampledImages.back().imageView != VK_NULL_HANDLE);
-    infoStorageImages.push_back(VkDescriptorImageInfo{
-        .sampler = VK_NULL_HANDLE,
-        .imageView = isStorageImage ? storageView : dummyImageView,
-        .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
-    });
+    infoStorageImages.push_back(d.storage);
     if (hasYcbcrSamplers && !workaround_noYcbcrSamplerArray_) {
       // we don't need to update this if there're no YUV samplers
-      infoYUVImages.push_back(VkDescriptorImageInfo{
-          .sampler = dummySampler, // this will be replaced by immutable samplers from VkPipeline
-          .imageView = isYUVImage ? view : dummyImageView,
-          .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-      });
+      infoYUVImages.push_back(d.yuv);
     }
   }
 
@@ -8761,11 +12016,7 @@ void lvk::VulkanContext::checkAndUpdateDescriptorSets() {
   infoSamplers.reserve(samplersPool_.objects_.size());
 
   for (const VkSampler& sampler : samplersPool_.objects_) {
-    infoSamplers.push_back({
-        .sampler = sampler ? sampler : samplersPool_.objects_[0],
-        .imageView = VK_NULL_HANDLE,
-        .imageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-    });
+    infoSamplers.push_back(getSamplerDescriptor(sampler));
   }
 
   // 3. Acceleration structures
@@ -8854,16 +12105,14 @@ void lvk::VulkanContext::checkAndUpdateDescriptorSets() {
     };
   }
 
-  // do not switch to the next descriptor set if there is nothing to update
-  if (numWrites) {
-#if LVK_VULKAN_PRINT_COMMANDS
-    LLOGL("vkUpdateDescriptorSets()\n");
-#endif // LVK_VULKAN_PRINT_COMMANDS
-    LVK_PROFILER_ZONE("vkUpdateDescriptorSets()", LVK_PROFILER_COLOR_PRESENT);
-    vkUpdateDescriptorSets(vkDevice_, numWrites, write, 0, nullptr);
-    LVK_PROFILER_ZONE_END();
-  }
+  writeDescriptors(dset, write, numWrites);
+
+  dset.numTextures = (uint32_t)infoSampledImages.size();
+  dset.numSamplers = (uint32_t)infoSamplers.size();
 
+  dirtyTextures_.clear();
+  dirtySamplers_.clear();
+  dirtyAccelStructs_ = false;
   awaitingCreation_ = false;
 }
 
@@ -8893,6 +12142,7 @@ lvk::SamplerHandle lvk::VulkanContext::createSampler(const VkSamplerCreateInfo&
   SamplerHandle handle = samplersPool_.create(VkSampler(sampler));
 
   awaitingCreation_ = true;
+  dirtySamplers_.push_back(handle.index());
 
   return handle;
 }
@@ -8964,6 +12214,152 @@ std::vector<uint8_t> lvk::VulkanContext::getPipelineCacheData() const {
   return data;
 }
 
+std::vector<uint8_t> lvk::VulkanContext::loadPipelineCacheFile() {
+  LVK_PROFILER_FUNCTION();
+
+  const VkPhysicalDeviceProperties& props = getVkPhysicalDeviceProperties();
+
+  const char hexDigits[] = "0123456789abcdef";
+  char uuid[VK_UUID_SIZE * 2 + 1] = {};
+  for (uint32_t i = 0; i != VK_UUID_SIZE; i++) {
+    uuid[i * 2 + 0] = hexDigits[(props.pipelineCacheUUID[i] >> 4) & 0xF];
+    uuid[i * 2 + 1] = hexDigits[props.pipelineCacheUUID[i] & 0xF];
+  }
+
+  // <pipelineCacheDirectory>/<vendorID>_<deviceID>/<driverVersion>_<pipelineCacheUUID>.bin
+  char deviceDir[32] = {};
+  char fileName[64] = {};
+  (void)snprintf(deviceDir, sizeof(deviceDir), "%08x_%08x", props.vendorID, props.deviceID);
+  (void)snprintf(fileName, sizeof(fileName), "%08x_%s.bin", props.driverVersion, uuid);
+
+  const std::filesystem::path dir = std::filesystem::path(config_.pipelineCacheDirectory) / deviceDir;
+
+  pimpl_->pipelineCacheFileName_ = (dir / fileName).string();
+  pimpl_->pipelineCacheNumPipelinesSaved_ = VulkanPipelineBuilder::getNumPipelinesCreated();
+  pimpl_->pipelineCacheSaveTime_ = std::chrono::steady_clock::now();
+
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+
+  // blobs from other driver versions (and interrupted writes) are never going to be used again; recent temporary files can belong
+  // to another process writing the cache right now
+  const auto now = std::filesystem::file_time_type::clock::now();
+  for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+    std::error_code ecTime;
+    const std::filesystem::file_time_type writeTime = it->last_write_time(ecTime);
+    if (it->path().extension() == ".tmp" && (ecTime || now - writeTime < std::chrono::minutes(10))) {
+      continue;
+    }
+    if (it->path().filename() != fileName) {
+      LLOGL("Removing stale pipeline cache %s\n", it->path().string().c_str());
+      std::filesystem::remove(it->path(), ec);
+    }
+  }
+
+  std::vector<uint8_t> data;
+
+  FILE* file = fopen(pimpl_->pipelineCacheFileName_.c_str(), "rb");
+
+  if (!file) {
+    return data;
+  }
+
+  SCOPE_EXIT {
+    fclose(file);
+  };
+
+  const uintmax_t size = std::filesystem::file_size(pimpl_->pipelineCacheFileName_, ec);
+
+  if (ec || !size) {
+    return data;
+  }
+
+  data.resize(size);
+
+  if (fread(data.data(), 1, data.size(), file) != data.size() || !isPipelineCacheCompatible(data.data(), data.size(), props)) {
+    LLOGW("Discarding invalid pipeline cache %s\n", pimpl_->pipelineCacheFileName_.c_str());
+    data.clear();
+  }
+
+  return data;
+}
+
+void lvk::VulkanContext::savePipelineCacheFile(bool async) {
+  LVK_PROFILER_FUNCTION();
+
+  if (pimpl_->pipelineCacheFileName_.empty() || pipelineCache_ == VK_NULL_HANDLE) {
+    return;
+  }
+
+  pimpl_->pipelineCacheNumPipelinesSaved_ = VulkanPipelineBuilder::getNumPipelinesCreated();
+  pimpl_->pipelineCacheSaveTime_ = std::chrono::steady_clock::now();
+
+  if (!async) {
+    writePipelineCacheFile();
+    return;
+  }
+
+  // the previous write is still running - the next period will catch up
+  if (pimpl_->pipelineCacheSaveDone_.valid() &&
+      pimpl_->pipelineCacheSaveDone_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+    return;
+  }
+
+  if (pimpl_->pipelineCompileThreads_.empty()) {
+    // vkGetPipelineCacheData() and the file write can take a while, so do not stall presentation
+    pimpl_->pipelineCacheSaveDone_ = std::async(std::launch::async, [this]() { writePipelineCacheFile(); });
+    return;
+  }
+
+  {
+    std::lock_guard lock(pimpl_->pipelineCompileMutex_);
+    pimpl_->pipelineCacheSaveTask_ = std::packaged_task<void()>([this]() { writePipelineCacheFile(); });
+    pimpl_->pipelineCacheSaveDone_ = pimpl_->pipelineCacheSaveTask_.get_future();
+  }
+  pimpl_->pipelineCompileCondition_.notify_one();
+}
+
+void lvk::VulkanContext::writePipelineCacheFile() const {
+  LVK_PROFILER_FUNCTION();
+
+  const std::string& fileName = pimpl_->pipelineCacheFileName_;
+
+  // vkGetPipelineCacheData() is safe while other threads create pipelines with the same cache
+  const std::vector<uint8_t> data = getPipelineCacheData();
+
+  if (!isPipelineCacheCompatible(data.data(), data.size(), getVkPhysicalDeviceProperties())) {
+    return;
+  }
+
+  // write a temporary file and rename it, so that a crash never leaves a truncated cache behind; the name is per process, so
+  // several processes sharing `pipelineCacheDirectory` never write into the same temporary file
+  const std::string tmpFileName = fileName + "." + std::to_string(getCurrentProcessId()) + ".tmp";
+
+  FILE* file = fopen(tmpFileName.c_str(), "wb");
+
+  if (!file) {
+    LLOGW("Cannot write pipeline cache %s\n", tmpFileName.c_str());
+    return;
+  }
+
+  const bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+
+  std::error_code ec;
+
+  if (fclose(file) != 0 || !written) {
+    LLOGW("Cannot write pipeline cache %s\n", tmpFileName.c_str());
+    std::filesystem::remove(tmpFileName, ec);
+    return;
+  }
+
+  std::filesystem::rename(tmpFileName, fileName, ec);
+
+  if (ec) {
+    LLOGW("Cannot rename %s: %s\n", tmpFileName.c_str(), ec.message().c_str());
+    std::filesystem::remove(tmpFileName, ec);
+  }
+}
+
 void lvk::VulkanContext::deferredTask(std::packaged_task<void()>&& task, SubmitHandle handle) const {
   if (handle.empty()) {
     handle = immediate_->getNextSubmitHandle();
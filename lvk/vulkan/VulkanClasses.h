@@ -12,8 +12,13 @@
 #include <ldrutils/lutils/Pool.h>
 #include <lvk/vulkan/VulkanUtils.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace lvk {
@@ -24,9 +29,11 @@ struct DeviceQueues final {
   const static uint32_t INVALID = 0xFFFFFFFF;
   uint32_t graphicsQueueFamilyIndex = INVALID;
   uint32_t computeQueueFamilyIndex = INVALID;
+  uint32_t transferQueueFamilyIndex = INVALID; // a transfer-only queue family (optional)
 
   VkQueue graphicsQueue = VK_NULL_HANDLE;
   VkQueue computeQueue = VK_NULL_HANDLE;
+  VkQueue transferQueue = VK_NULL_HANDLE;
 };
 
 struct VulkanBuffer final {
@@ -36,6 +43,8 @@ struct VulkanBuffer final {
   // clang-format on
 
   void bufferSubData(const VulkanContext& ctx, size_t offset, size_t size, const void* data);
+  // reads `size` bytes from the current position of `file` straight into the mapped memory; returns false on a short read
+  bool bufferSubData(const VulkanContext& ctx, size_t offset, size_t size, FILE* file);
   void getBufferSubData(const VulkanContext& ctx, size_t offset, size_t size, void* data);
   void flushMappedMemory(const VulkanContext& ctx, VkDeviceSize offset, VkDeviceSize size) const;
   void invalidateMappedMemory(const VulkanContext& ctx, VkDeviceSize offset, VkDeviceSize size) const;
@@ -179,9 +188,13 @@ class VulkanSwapchain final {
 
 class VulkanImmediateCommands final {
  public:
-  // the maximum number of command buffers which can similtaneously exist in the system; when we run out of buffers, we stall and wait until
-  // an existing buffer becomes available
-  static constexpr uint32_t kMaxCommandBuffers = 64;
+  // the number of command buffers allocated upfront; when all of them are in flight, the pool grows instead of stalling
+  static constexpr uint32_t kNumInitialCommandBuffers = 64;
+  // the maximum number of command buffers which can similtaneously exist in the system (SubmitHandle::bufferIndex_ is 16 bits); when we
+  // run out of buffers, we stall and wait until the oldest submitted buffer becomes available
+  static constexpr uint32_t kMaxCommandBuffers = 1024;
+  // the maximum number of command buffers in one batched submit()
+  static constexpr uint32_t kMaxBatchedCommandBuffers = 64;
 
   VulkanImmediateCommands(VkDevice device, uint32_t queueFamilyIndex, bool has_EXT_device_fault, const char* debugName);
   ~VulkanImmediateCommands();
@@ -192,15 +205,17 @@ class VulkanImmediateCommands final {
     VkCommandBuffer cmdBuf_ = VK_NULL_HANDLE;
     VkCommandBuffer cmdBufAllocated_ = VK_NULL_HANDLE;
     SubmitHandle handle_ = {};
-    VkFence fence_ = VK_NULL_HANDLE;
     VkSemaphore semaphore_ = VK_NULL_HANDLE;
-    mutable uint64_t signaledTimelineValue_ = 0; // value signaled on submitTimelineSemaphore_ by this submission (cross-queue waits)
+    // value signaled on submitTimelineSemaphore_ by this submission (completion tracking and cross-queue waits)
+    mutable uint64_t signaledTimelineValue_ = 0;
     mutable bool isEncoding_ = false;
   };
 
   // returns the current command buffer (creates one if it does not exist)
   const CommandBufferWrapper& acquire();
   SubmitHandle submit(const CommandBufferWrapper& wrapper);
+  // one vkQueueSubmit2() for all `wrappers` (executed in this order) with a single timeline signal; returns the handle of the last one
+  SubmitHandle submit(const CommandBufferWrapper* const* wrappers, uint32_t numWrappers);
   void waitSemaphore(VkSemaphore semaphore);
   void waitTimelineSemaphore(VkSemaphore semaphore, uint64_t value);
   void signalSemaphore(VkSemaphore semaphore, uint64_t signalValue);
@@ -211,17 +226,25 @@ class VulkanImmediateCommands final {
   }
   uint64_t getTimelineValue(SubmitHandle handle) const;
   void setLastPresentSemaphore(VkSemaphore semaphore, VkFence presentFence);
-  VkFence getVkFence(SubmitHandle handle) const;
   SubmitHandle getLastSubmitHandle() const;
   SubmitHandle getNextSubmitHandle() const;
+  // compares against the cached completed timeline value first; refreshes it (unless `fastCheckNoVulkan`) if that is not enough
   bool isReady(SubmitHandle handle, bool fastCheckNoVulkan = false) const;
+  // one vkGetSemaphoreCounterValue(); called once per frame and whenever the cached value is too old to answer isReady()
+  uint64_t updateCompletedTimelineValue() const;
   void wait(SubmitHandle handle);
   void waitAll();
+  CommandBufferStats getStats() const {
+    return stats_;
+  }
 
  private:
   friend class lvk::VulkanContext;
 
+  void createCommandBuffer();
   void purge();
+  bool isComplete(const CommandBufferWrapper& buf) const;
+  void waitUntilComplete(const CommandBufferWrapper& buf) const;
 
  private:
   VkDevice device_ = VK_NULL_HANDLE;
@@ -230,7 +253,9 @@ class VulkanImmediateCommands final {
   uint32_t queueFamilyIndex_ = 0;
   bool has_EXT_device_fault_ = false;
   const char* debugName_ = "";
-  CommandBufferWrapper buffers_[kMaxCommandBuffers];
+  std::deque<CommandBufferWrapper> buffers_; // grows on demand, references to the wrappers remain valid
+  std::vector<uint32_t> freeBuffers_; // indices into `buffers_`
+  std::deque<uint32_t> submittedBuffers_; // in submission order, i.e. sorted by `signaledTimelineValue_`
   SubmitHandle lastSubmitHandle_ = SubmitHandle();
   SubmitHandle nextSubmitHandle_ = SubmitHandle();
   VkSemaphoreSubmitInfo lastSubmitSemaphore_ = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
@@ -244,10 +269,13 @@ class VulkanImmediateCommands final {
   VkSemaphore lastPresentSemaphore_ = VK_NULL_HANDLE; // present-wait semaphore of the last vkQueuePresentKHR()
   VkFence lastPresentFence_ = VK_NULL_HANDLE; // its present fence; acquire() waits it before reusing that slot
   VkSemaphore submitTimelineSemaphore_ = VK_NULL_HANDLE; // monotonic timeline signaled by every submit() (cross-queue waits)
-  uint32_t numAvailableCommandBuffers_ = kMaxCommandBuffers;
+  mutable std::atomic<uint64_t> completedTimelineValue_ = 0; // the last value read back from submitTimelineSemaphore_
   uint32_t submitCounter_ = 1;
+  CommandBufferStats stats_ = {};
 };
 
+struct RenderPipelineCompileJob;
+
 struct RenderPipelineState final {
   RenderPipelineDesc desc_;
 
@@ -263,12 +291,37 @@ struct RenderPipelineState final {
   VkDescriptorSetLayout lastVkDescriptorSetLayout_ = VK_NULL_HANDLE;
 
   VkShaderStageFlags shaderStageFlags_ = 0;
-  VkPipelineLayout pipelineLayout_ = VK_NULL_HANDLE;
-  VkPipeline pipeline_ = VK_NULL_HANDLE;
+  VkPipelineLayout pipelineLayout_ = VK_NULL_HANDLE; // shared by all variants
 
   void* specConstantDataStorage_ = nullptr;
 
-  uint32_t viewMask_ = 0;
+  // one VkPipeline per view mask, so switching between multiview and regular rendering does not rebuild anything
+  enum { LVK_MAX_PIPELINE_VARIANTS = 4 };
+  struct Variant {
+    uint32_t viewMask = 0;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    // owned, `pipeline` is being built (or optimized) on a worker thread (see ContextConfig::numPipelineCompileThreads)
+    RenderPipelineCompileJob* compileJob = nullptr;
+  };
+  Variant variants_[LVK_MAX_PIPELINE_VARIANTS] = {}; // the least recently created variant is evicted first
+  uint32_t numVariants_ = 0;
+
+  Variant* getVariant(uint32_t viewMask) {
+    for (uint32_t i = 0; i != numVariants_; i++) {
+      if (variants_[i].viewMask == viewMask) {
+        return &variants_[i];
+      }
+    }
+    return nullptr;
+  }
+  const Variant* getVariant(uint32_t viewMask) const {
+    return const_cast<RenderPipelineState*>(this)->getVariant(viewMask);
+  }
+
+  // pipelines with identical descriptions share the Vulkan objects above, they belong to the oldest one (`owner_` is empty there)
+  uint64_t hash_ = 0;
+  std::vector<uint8_t> key_; // the normalized description `hash_` was computed from
+  RenderPipelineHandle owner_;
 };
 
 class VulkanPipelineBuilder final {
@@ -305,11 +358,35 @@ class VulkanPipelineBuilder final {
                  VkPipelineLayout pipelineLayout,
                  VkPipeline* outPipeline,
                  const char* debugName = nullptr) noexcept;
+  // VK_EXT_graphics_pipeline_library: one part of the pipeline (`libraryFlags`), only the shader stages of that part are used
+  VkResult buildLibrary(VkDevice device,
+                        VkPipelineCache pipelineCache,
+                        VkPipelineLayout pipelineLayout,
+                        VkGraphicsPipelineLibraryFlagsEXT libraryFlags,
+                        VkPipeline* outPipeline,
+                        const char* debugName = nullptr) noexcept;
+  // a complete pipeline out of libraries created by buildLibrary(), only the creation flags of this builder are used
+  VkResult link(VkDevice device,
+                VkPipelineCache pipelineCache,
+                VkPipelineLayout pipelineLayout,
+                const VkPipeline* libraries,
+                uint32_t numLibraries,
+                bool optimize,
+                VkPipeline* outPipeline,
+                const char* debugName = nullptr) noexcept;
 
   static uint32_t getNumPipelinesCreated() {
     return numPipelinesCreated_;
   }
 
+ private:
+  VkResult createPipeline(VkDevice device,
+                          VkPipelineCache pipelineCache,
+                          VkPipelineLayout pipelineLayout,
+                          VkGraphicsPipelineLibraryFlagsEXT libraryFlags,
+                          VkPipeline* outPipeline,
+                          const char* debugName) noexcept;
+
  private:
   enum { LVK_MAX_DYNAMIC_STATES = 128 };
   uint32_t numDynamicStates_ = 0;
@@ -334,7 +411,7 @@ class VulkanPipelineBuilder final {
   VkFormat depthAttachmentFormat_ = VK_FORMAT_UNDEFINED;
   VkFormat stencilAttachmentFormat_ = VK_FORMAT_UNDEFINED;
 
-  static uint32_t numPipelinesCreated_;
+  static std::atomic<uint32_t> numPipelinesCreated_; // build() can run on pipeline compilation threads
 };
 
 struct ComputePipelineState final {
@@ -347,6 +424,11 @@ struct ComputePipelineState final {
   VkPipeline pipeline_ = VK_NULL_HANDLE;
 
   void* specConstantDataStorage_ = nullptr;
+
+  // pipelines with identical descriptions share the Vulkan objects above, they belong to the oldest one (`owner_` is empty there)
+  uint64_t hash_ = 0;
+  std::vector<uint8_t> key_; // the normalized description `hash_` was computed from
+  ComputePipelineHandle owner_;
 };
 
 struct RayTracingPipelineState final {
@@ -383,6 +465,7 @@ struct ShaderModuleState final {
       .pCode = nullptr,
   };
   uint32_t pushConstantsSize = 0;
+  uint64_t spirvHash = 0; // pipelines are deduplicated by the contents of their shaders
 };
 
 struct AccelerationStructure {
@@ -394,10 +477,41 @@ struct AccelerationStructure {
   lvk::Holder<lvk::BufferHandle> scratchBuffer; // Store only for TLAS
 };
 
+// attachment formats and size of a render pass; a secondary command buffer can be executed only inside a render pass with the same ones
+struct SecondaryRenderingInfo final {
+  VkFormat colorFormats[LVK_MAX_COLOR_ATTACHMENTS] = {};
+  uint32_t numColorFormats = 0;
+  VkFormat depthFormat = VK_FORMAT_UNDEFINED;
+  VkFormat stencilFormat = VK_FORMAT_UNDEFINED;
+  VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+  uint32_t width = 0; // of the rendered mip-level
+  uint32_t height = 0;
+  uint32_t viewMask = 0;
+
+  bool operator==(const SecondaryRenderingInfo& other) const = default;
+};
+
+struct CommandListState final {
+  std::function<void(ICommandBuffer& cmdBuffer)> record_;
+  VulkanImmediateCommands::CommandBufferWrapper wrapper_; // the current recording, VK_NULL_HANDLE until the first execution
+  const char* debugName_ = "";
+
+  // what the current recording depends on (see VulkanSecondaryCommands::isValid())
+  SecondaryRenderingInfo renderingInfo_ = {};
+  uint64_t descriptorSetsGeneration_ = 0;
+  std::vector<std::pair<RenderPipelineHandle, VkPipeline>> pipelines_;
+};
+
 class CommandBuffer final : public ICommandBuffer {
  public:
   CommandBuffer() = default;
   CommandBuffer(VulkanContext* ctx, VulkanImmediateCommands& immediate, uint32_t queueFamilyIndex);
+  // a secondary command buffer recorded on a worker thread inside the render pass `fb` (see VulkanSecondaryCommands)
+  CommandBuffer(VulkanContext* ctx,
+                const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                const Framebuffer& fb,
+                uint32_t viewMask,
+                uint32_t threadIndex);
   ~CommandBuffer() override;
 
   CommandBuffer& operator=(CommandBuffer&& other) = default;
@@ -419,6 +533,8 @@ class CommandBuffer final : public ICommandBuffer {
   void cmdBeginRendering(const lvk::RenderPass& renderPass, const lvk::Framebuffer& desc, const Dependencies& deps) override;
   void cmdEndRendering() override;
   void cmdNextSubpass() override;
+  void cmdExecuteCommands(const ldr::Span<ICommandBuffer*>& secondaryCommandBuffers) override;
+  void cmdExecuteCommandList(CommandListHandle commandList) override;
 
   void cmdBindViewport(const Viewport& viewport) override;
   void cmdBindScissorRect(const ScissorRect& rect) override;
@@ -440,6 +556,8 @@ class CommandBuffer final : public ICommandBuffer {
                       uint32_t firstIndex,
                       int32_t vertexOffset,
                       uint32_t baseInstance) override;
+  void cmdDrawMulti(const ldr::Span<DrawRange>& draws, uint32_t instanceCount, uint32_t baseInstance) override;
+  void cmdDrawMultiIndexed(const ldr::Span<DrawIndexedRange>& draws, uint32_t instanceCount, uint32_t baseInstance) override;
   void cmdDrawIndirect(BufferHandle indirectBuffer, size_t indirectBufferOffset, uint32_t drawCount, uint32_t stride = 0) override;
   void cmdDrawIndexedIndirect(BufferHandle indirectBuffer, size_t indirectBufferOffset, uint32_t drawCount, uint32_t stride = 0) override;
   void cmdDrawIndexedIndirectCount(BufferHandle indirectBuffer,
@@ -506,9 +624,12 @@ class CommandBuffer final : public ICommandBuffer {
   // Completes a cross-queue ownership transfer for `img` if the producing queue armed one; returns true if an acquire was emitted
   bool acquireOwnershipIfPending(lvk::VulkanImage& img, StageAccess dst) const;
   bool isComputeOnlyQueue() const;
+  // updates the emitted/skipped counters and returns `isRedundant`
+  bool skipRedundantState(bool isRedundant);
 
  private:
   friend class VulkanContext;
+  friend class VulkanSecondaryCommands;
 
   VulkanContext* ctx_ = nullptr;
   const VulkanImmediateCommands::CommandBufferWrapper* wrapper_ = nullptr;
@@ -522,6 +643,8 @@ class CommandBuffer final : public ICommandBuffer {
 
   lvk::Framebuffer framebuffer_ = {};
   lvk::SubmitHandle lastSubmitHandle_ = {};
+  // VulkanContext::descriptorSetsGeneration_ at acquisition: every descriptor set current since then may be bound here
+  uint64_t acquiredDescriptorSetsGeneration_ = 0;
 
   struct {
     VkDescriptorImageInfo imageInfos[LVK_MAX_COLOR_ATTACHMENTS] = {};
@@ -530,15 +653,102 @@ class CommandBuffer final : public ICommandBuffer {
   } inputAttachments_;
 
   VkPipeline lastPipelineBound_ = VK_NULL_HANDLE;
+  // resolved once when a pipeline is bound (cmdPushConstants() needs them)
+  VkPipelineLayout lastPipelineLayout_ = VK_NULL_HANDLE;
+  VkShaderStageFlags lastPushConstantsStageFlags_ = 0;
+
+  // redundant state filtering: the last state recorded into this command buffer (undefined after vkCmdExecuteCommands())
+  static constexpr uint32_t kMaxCachedPushConstantsSize = 256;
+  struct VertexBufferBinding {
+    VkBuffer buffer = VK_NULL_HANDLE; // VK_NULL_HANDLE - unknown
+    uint64_t offset = 0;
+    uint64_t size = 0;
+  };
+  struct StateCache {
+    bool hasViewport = false;
+    bool hasScissor = false;
+    bool hasDepthState = false;
+    bool hasDepthBias = false;
+    VkViewport viewport = {};
+    VkRect2D scissor = {};
+    DepthState depthState = {};
+    float depthBias[3] = {}; // constant factor, clamp, slope factor
+    VertexBufferBinding vertexBuffers[VertexInput::LVK_VERTEX_BUFFER_MAX] = {};
+    VertexBufferBinding indexBuffer = {};
+    VkIndexType indexType = VK_INDEX_TYPE_UINT32;
+    VkPipelineLayout pushConstantsLayout = VK_NULL_HANDLE; // VK_NULL_HANDLE - unknown
+    uint32_t pushConstantsOffset = 0;
+    uint32_t pushConstantsSize = 0;
+    uint8_t pushConstants[kMaxCachedPushConstantsSize] = {};
+  } stateCache_;
+  uint32_t numStateCommandsEmitted_ = 0;
+  uint32_t numStateCommandsSkipped_ = 0;
+
+  // the bound render pipeline is still being compiled in the background and has no fallback
+  bool skipDraws_ = false;
 
   bool isRendering_ = false;
   uint32_t viewMask_ = 0;
 
+  bool isSecondary_ = false;
+  uint32_t secondaryThreadIndex_ = 0;
+  bool hasSecondaryContents_ = false; // inside a render pass started with RenderPass::useSecondaryCommandBuffers
+  lvk::RenderPass renderPass_ = {}; // command lists are (re)recorded against the current render pass
+  CommandListState* commandList_ = nullptr; // this secondary command buffer records a command list
+  // retired together with this primary command buffer's submission
+  std::vector<const CommandBuffer*> executedSecondaries_;
+
   lvk::RenderPipelineHandle currentPipelineGraphics_ = {};
   lvk::ComputePipelineHandle currentPipelineCompute_ = {};
   lvk::RayTracingPipelineHandle currentPipelineRayTracing_ = {};
 };
 
+// Secondary command buffers recorded on worker threads. Each thread index owns its VkCommandPool, so different threads record in parallel.
+// A buffer is recycled by its recording thread once the timeline value of the primary submission which executed it has been reached.
+class VulkanSecondaryCommands final {
+ public:
+  VulkanSecondaryCommands(VulkanContext& ctx, uint32_t maxThreads);
+  ~VulkanSecondaryCommands();
+  VulkanSecondaryCommands(const VulkanSecondaryCommands&) = delete;
+  VulkanSecondaryCommands& operator=(const VulkanSecondaryCommands&) = delete;
+
+  // called on the recording thread
+  CommandBuffer& acquire(uint32_t threadIndex, const RenderPass& renderPass, const Framebuffer& fb);
+  void end(CommandBuffer& commandBuffer);
+  // called on the render thread after the primary command buffer which executed `secondaries` has been submitted
+  void markSubmitted(const std::vector<const CommandBuffer*>& secondaries, uint64_t timelineValue);
+
+  // command lists are recorded and executed on the render thread
+  bool isValid(const CommandListState& list, const RenderPass& renderPass, const Framebuffer& fb) const;
+  void record(CommandListState& list, const RenderPass& renderPass, const Framebuffer& fb);
+  void destroy(CommandListState& list);
+
+ private:
+  SecondaryRenderingInfo getRenderingInfo(const RenderPass& renderPass, const Framebuffer& fb) const;
+  // begins `wrapper` for `info` and sets the default dynamic state
+  void begin(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+             CommandBuffer& commandBuffer,
+             const SecondaryRenderingInfo& info,
+             const Framebuffer& fb,
+             VkCommandBufferUsageFlags flags,
+             uint32_t threadIndex);
+
+ private:
+  struct Secondary {
+    VulkanImmediateCommands::CommandBufferWrapper wrapper;
+    CommandBuffer commandBuffer;
+  };
+  struct ThreadCommands {
+    VkCommandPool pool = VK_NULL_HANDLE; // created lazily by the first acquire() with this thread index
+    std::deque<Secondary> buffers; // stable addresses: the returned command buffers are referenced until they are executed
+    std::mutex mutex; // `signaledTimelineValue_` of the wrappers is written by the render thread in markSubmitted()
+  };
+
+  VulkanContext& ctx_;
+  std::vector<std::unique_ptr<ThreadCommands>> threads_;
+  VkCommandPool commandListsPool_ = VK_NULL_HANDLE; // created lazily by the first recorded command list
+};
+
 class VulkanStagingDevice final {
  public:
   explicit VulkanStagingDevice(VulkanContext& ctx);
@@ -547,7 +757,8 @@ class VulkanStagingDevice final {
   VulkanStagingDevice(const VulkanStagingDevice&) = delete;
   VulkanStagingDevice& operator=(const VulkanStagingDevice&) = delete;
 
-  void bufferSubData(VulkanBuffer& buffer, size_t dstOffset, size_t size, const void* data);
+  // `isInitialData` marks the first upload into a new buffer which the GPU cannot be using yet (it may go to the transfer queue)
+  void bufferSubData(VulkanBuffer& buffer, size_t dstOffset, size_t size, const void* data, bool isInitialData = false);
   void imageData2D(VulkanImage& image,
                    const VkRect2D& imageRegion,
                    uint32_t baseMipLevel,
@@ -558,12 +769,65 @@ class VulkanStagingDevice final {
                    const void* data,
                    uint32_t bufferRowLength);
   void imageData3D(VulkanImage& image, const VkOffset3D& offset, const VkExtent3D& extent, VkFormat format, const void* data);
+  // stream from the current position of `file` straight into the staging memory (no host copies); return false on a read error
+  bool bufferSubDataFromFile(VulkanBuffer& buffer, size_t dstOffset, size_t size, FILE* file);
+  bool imageData2DFromFile(VulkanImage& image,
+                           const VkRect2D& imageRegion,
+                           uint32_t baseMipLevel,
+                           uint32_t numMipLevels,
+                           uint32_t baseLayer,
+                           uint32_t numLayers,
+                           VkFormat format,
+                           FILE* file);
   void getImageData(VulkanImage& image,
                     const VkOffset3D& offset,
                     const VkExtent3D& extent,
                     VkImageSubresourceRange range,
                     VkFormat format,
                     void* outData);
+  void getBufferData(VulkanBuffer& buffer, size_t offset, size_t size, void* outData);
+
+  // non-blocking readbacks into the readback ring
+  ReadbackTicket readbackBuffer(VulkanBuffer& buffer, size_t offset, size_t size);
+  ReadbackTicket readbackImage(VulkanImage& image,
+                               const VkOffset3D& offset,
+                               const VkExtent3D& extent,
+                               VkImageSubresourceRange range,
+                               VkFormat format);
+  // returns nullptr while the copy is still in flight
+  const void* getReadbackData(const ReadbackTicket& ticket);
+  void releaseReadback(const ReadbackTicket& ticket);
+
+  // thread-safe staging reservations: any thread fills the mapped memory, the render thread records the copies (never stalls)
+  StagingReservation reserve(size_t size, Result* outResult);
+  void cancelReservation(const StagingReservation& reservation);
+  void bufferSubData(VulkanBuffer& buffer, size_t dstOffset, const StagingReservation& reservation);
+  void imageData2D(VulkanImage& image,
+                   const VkRect2D& imageRegion,
+                   uint32_t baseMipLevel,
+                   uint32_t numMipLevels,
+                   uint32_t baseLayer,
+                   uint32_t numLayers,
+                   VkFormat format,
+                   const StagingReservation& reservation);
+  // render thread only: reservations are retired in order once they are both consumed and completed by the GPU
+  void retireReservations();
+
+  const StagingStats& getStats() const {
+    return stats_;
+  }
+  // Tracy plots: per-frame deltas of the counters and the current sizes
+  void plotStats();
+
+  // while a batch is open, all staged copies are recorded into one shared command buffer
+  void beginBatch();
+  SubmitHandle endBatch();
+  // submits the pending batch command buffers (if any) and keeps the batch open
+  void flushBatch();
+  // the graphics queue acquires the ownership of everything released by the transfer queue (a no-op without a transfer queue)
+  void flushPendingAcquires();
+  const VulkanImmediateCommands::CommandBufferWrapper& acquireCommandBuffer(bool useTransferQueue = false);
+  SubmitHandle submitCommandBuffer(const VulkanImmediateCommands::CommandBufferWrapper& wrapper);
 
  private:
   enum { kStagingBufferAlignment = 16 }; // updated to support BC7 compressed image
@@ -574,10 +838,88 @@ class VulkanStagingDevice final {
     SubmitHandle handle_ = {};
   };
 
+  struct ReadbackRegionDesc {
+    uint32_t id_ = 0;
+    uint64_t offset_ = 0;
+    uint64_t size_ = 0;
+    uint64_t ringBytes_ = 0; // bytes taken from the ring, including the padding skipped on a wrap-around (0 for dedicated buffers)
+    SubmitHandle handle_ = {};
+    bool isReleased_ = false;
+    bool isInvalidated_ = false;
+    lvk::Holder<BufferHandle> dedicatedBuffer_; // readbacks which do not fit into the ring
+  };
+
+  struct ReservationDesc {
+    uint32_t id_ = 0;
+    uint64_t offset_ = 0;
+    uint64_t size_ = 0;
+    uint64_t ringBytes_ = 0; // bytes taken from the ring, including the padding skipped on a wrap-around
+    SubmitHandle handle_ = {}; // the copy out of this reservation (empty if cancelled)
+    bool isConsumed_ = false; // claimed by an upload or cancelled
+  };
+
+  // returns a contiguous region of `size` bytes (or the entire ring if `size` is larger than the ring); stalls only if the ring is full
   MemoryRegionDesc getNextFreeOffset(VkDeviceSize size);
   void ensureStagingBufferSize(VkDeviceSize sizeNeeded);
+  // regions are retired in the same order they were allocated, so they have to be inserted in that order
   void insertRegion(const MemoryRegionDesc& region);
+  void retireRegions();
   void waitAndReset();
+  // uploads and readbacks larger than the entire ring use a dedicated buffer which is released when its submit handle retires
+  lvk::Holder<BufferHandle> createOversizeStagingBuffer(VkDeviceSize size);
+  // never stalls: if the readback ring has no room, the region gets a dedicated buffer
+  ReadbackRegionDesc& allocateReadback(VkDeviceSize size);
+  ReadbackRegionDesc* findReadback(const ReadbackTicket& ticket);
+  void retireReadbacks();
+  void addStagedChunk(VkDeviceSize size);
+  void addForcedWait(std::chrono::steady_clock::time_point startTime);
+  // requires `reservationsMutex_`
+  ReservationDesc* findReservation(const StagingReservation& reservation);
+  // the source of an upload is either `data` or `file` (read straight into the mapped staging memory, chunk by chunk)
+  bool uploadBufferSubData(VulkanBuffer& buffer, size_t dstOffset, size_t size, const void* data, FILE* file, bool isInitialData);
+  bool uploadImageData2D(VulkanImage& image,
+                         const VkRect2D& imageRegion,
+                         uint32_t baseMipLevel,
+                         uint32_t numMipLevels,
+                         uint32_t baseLayer,
+                         uint32_t numLayers,
+                         VkFormat format,
+                         const void* data,
+                         FILE* file,
+                         uint32_t bufferRowLength);
+  // records the copies of all mip-levels and layers (laid out as in imageData2D()) from a filled staging buffer into the image
+  void recordImageData2D(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                         VulkanImage& image,
+                         const VkRect2D& imageRegion,
+                         uint32_t baseMipLevel,
+                         uint32_t numMipLevels,
+                         uint32_t baseLayer,
+                         uint32_t numLayers,
+                         VkFormat format,
+                         VkBuffer srcBuffer,
+                         VkDeviceSize srcOffset,
+                         uint32_t bufferRowLength,
+                         bool useTransferQueue);
+  // transfer-only queues need 4-byte aligned buffer offsets (VUID-vkCmdCopyBufferToImage-commandBuffer-07737), recordImageData2D()
+  // packs mip-levels and planes tightly, which breaks that for small formats like R8
+  static bool hasAlignedImageRegions2D(const VkRect2D& imageRegion,
+                                       uint32_t baseMipLevel,
+                                       uint32_t numMipLevels,
+                                       uint32_t numLayers,
+                                       VkFormat format);
+  // the queue which produced `handle` (staging regions can be in flight on the graphics and transfer queues)
+  VulkanImmediateCommands& getImmediateCommands(SubmitHandle handle) const;
+  bool isTransferQueue(const VulkanImmediateCommands::CommandBufferWrapper& wrapper) const;
+  // record the release half of a transfer->graphics queue family ownership transfer; flushPendingAcquires() records the acquire half
+  void releaseBufferOwnership(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                              VkBuffer buffer,
+                              VkDeviceSize offset,
+                              VkDeviceSize size);
+  void releaseImageOwnership(const VulkanImmediateCommands::CommandBufferWrapper& wrapper,
+                             VkImage image,
+                             VkImageLayout oldLayout,
+                             VkImageLayout newLayout,
+                             const VkImageSubresourceRange& range);
 
  private:
   VulkanContext& ctx_;
@@ -587,7 +929,37 @@ class VulkanStagingDevice final {
   // the staging buffer grows from minBufferSize up to maxBufferSize as needed
   VkDeviceSize maxBufferSize_ = 0;
   VkDeviceSize minBufferSize_ = 4u * 2048u * 2048u; // ad hoc value to avoid frequent reallocations
-  std::vector<MemoryRegionDesc> regions_;
+  // ring allocator: new regions are carved at `head_`, in-flight regions are retired from the front of `inFlight_` in submission order
+  std::deque<MemoryRegionDesc> inFlight_;
+  VkDeviceSize head_ = 0;
+  bool isBatching_ = false;
+  bool hasBatchSubmits_ = false;
+  const VulkanImmediateCommands::CommandBufferWrapper* batchWrapper_ = nullptr; // not submitted yet
+  const VulkanImmediateCommands::CommandBufferWrapper* batchWrapperTransfer_ = nullptr; // not submitted yet
+  // acquire barriers replaying the releases recorded on the transfer queue
+  std::vector<VkBufferMemoryBarrier2> pendingBufferAcquires_;
+  std::vector<VkImageMemoryBarrier2> pendingImageAcquires_;
+  SubmitHandle pendingAcquiresHandle_ = {}; // the most recent transfer submit which released anything
+  // readback ring: regions are retired in order once they are both completed by the GPU and released by the app
+  lvk::Holder<BufferHandle> readbackBuffer_;
+  VkDeviceSize readbackBufferSize_ = 0;
+  std::deque<ReadbackRegionDesc> readbacks_;
+  VkDeviceSize readbackHead_ = 0;
+  VkDeviceSize readbackTail_ = 0;
+  VkDeviceSize readbackUsed_ = 0;
+  uint32_t readbackCounter_ = 0;
+  // reservation ring: allocated up front (ContextConfig::stagingReservationRingSize), guarded by `reservationsMutex_`
+  std::mutex reservationsMutex_;
+  lvk::Holder<BufferHandle> reservationBuffer_;
+  uint8_t* reservationMappedPtr_ = nullptr;
+  VkDeviceSize reservationBufferSize_ = 0;
+  std::deque<ReservationDesc> reservations_;
+  VkDeviceSize reservationHead_ = 0;
+  VkDeviceSize reservationTail_ = 0;
+  VkDeviceSize reservationUsed_ = 0;
+  uint32_t reservationCounter_ = 0;
+  StagingStats stats_ = {};
+  StagingStats lastPlottedStats_ = {};
 };
 
 class VulkanContext final : public IContext {
@@ -598,6 +970,7 @@ class VulkanContext final : public IContext {
   ICommandBuffer& acquireCommandBuffer(bool dedicatedCompute = false) override;
 
   SubmitHandle submit(lvk::ICommandBuffer& commandBuffer, TextureHandle present, const ldr::Span<TextureHandle>& release = {}) override;
+  SubmitHandle submit(const ldr::Span<ICommandBuffer*>& commandBuffers, TextureHandle present, SubmitHandle* outHandles) override;
   void wait(SubmitHandle handle) override;
 
   Holder<BufferHandle> createBuffer(const BufferDesc& desc, const char* debugName, Result* outResult) override;
@@ -626,10 +999,14 @@ class VulkanContext final : public IContext {
   void destroy(TextureHandle handle) override;
   void destroy(QueryPoolHandle handle) override;
   void destroy(AccelStructHandle handle) override;
+  void destroy(CommandListHandle handle) override;
   void destroy(Framebuffer& fb) override;
 
   uint64_t gpuAddress(AccelStructHandle handle) const override;
 
+  bool isPipelineReady(RenderPipelineHandle handle, uint32_t viewMask) override;
+  void warmupPipelines(const ldr::Span<RenderPipelineHandle>& pipelines, const ldr::Span<uint32_t>& viewMasks) override;
+
   Result upload(BufferHandle handle, const void* data, size_t size, size_t offset) override;
   Result download(BufferHandle handle, void* data, size_t size, size_t offset) override;
   uint8_t* getMappedPtr(BufferHandle handle) const override;
@@ -642,6 +1019,29 @@ class VulkanContext final : public IContext {
   float getAspectRatio(TextureHandle handle) const override;
   Format getFormat(TextureHandle handle) const override;
 
+  ReadbackTicket downloadAsync(BufferHandle handle, size_t size, size_t offset, Result* outResult) override;
+  ReadbackTicket downloadAsync(TextureHandle handle, const TextureRangeDesc& range, Result* outResult) override;
+  const void* getReadbackData(const ReadbackTicket& ticket) override;
+  void releaseReadback(const ReadbackTicket& ticket) override;
+
+  StagingReservation reserveStaging(size_t size, Result* outResult) override;
+  void cancelStaging(const StagingReservation& reservation) override;
+  Result upload(BufferHandle handle, const StagingReservation& reservation, size_t offset) override;
+  Result upload(TextureHandle handle, const TextureRangeDesc& range, const StagingReservation& reservation) override;
+
+  Result uploadFromFile(BufferHandle handle, const char* fileName, size_t fileOffset, size_t size, size_t offset = 0) override;
+  Result uploadFromFile(TextureHandle handle, const TextureRangeDesc& range, const char* fileName, size_t fileOffset = 0) override;
+
+  void beginUploadBatch() override;
+  SubmitHandle endUploadBatch() override;
+
+  ICommandBuffer& acquireSecondaryCommandBuffer(uint32_t threadIndex, const RenderPass& renderPass, const Framebuffer& fb) override;
+  void endSecondaryCommandBuffer(ICommandBuffer& commandBuffer) override;
+
+  Holder<CommandListHandle> createCommandList(std::function<void(ICommandBuffer& cmdBuffer)> record,
+                                              const char* debugName,
+                                              Result* outResult) override;
+
   TextureHandle getCurrentSwapchainTexture() override;
   Format getSwapchainFormat() const override;
   ColorSpace getSwapchainColorSpace() const override;
@@ -658,6 +1058,9 @@ class VulkanContext final : public IContext {
   }
 
   double getTimestampPeriodToMs() const override;
+  StagingStats getStagingStats() const override;
+  CommandBufferStats getCommandBufferStats() const override;
+  DescriptorSetStats getDescriptorSetStats() const override;
   bool getQueryPoolResults(QueryPoolHandle pool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* outData, size_t stride)
       const override;
 
@@ -666,7 +1069,8 @@ class VulkanContext final : public IContext {
   ///////////////
 
   VkPipeline getVkPipeline(ComputePipelineHandle handle);
-  VkPipeline getVkPipeline(RenderPipelineHandle handle, uint32_t viewMask);
+  // `wait == false` returns VK_NULL_HANDLE while the pipeline is compiled on a background thread
+  VkPipeline getVkPipeline(RenderPipelineHandle handle, uint32_t viewMask, bool wait = true);
   VkPipeline getVkPipeline(RayTracingPipelineHandle handle);
 
   uint32_t queryDevices(HWDeviceDesc* outDevices, uint32_t maxOutDevices = 1);
@@ -730,10 +1134,19 @@ class VulkanContext final : public IContext {
     uint32_t maxTextures = 0;
     uint32_t maxSamplers = 0;
     uint32_t maxAccelStructs = 0;
-    VkDescriptorSetLayout vkDSL = VK_NULL_HANDLE;
+    VkDescriptorSetLayout vkDSL = VK_NULL_HANDLE; // not owned, `vkDSL_` at the time of allocation
     VkDescriptorPool vkDPool = VK_NULL_HANDLE;
     VkDescriptorSet vkDSet = VK_NULL_HANDLE;
     SubmitHandle handle_ = {}; // last use
+    uint64_t retiredGeneration = UINT64_MAX; // `descriptorSetsGeneration_` when it stopped being current
+    // slots [0...numTextures) and [0...numSamplers) have been written at least once
+    uint32_t numTextures = 0;
+    uint32_t numSamplers = 0;
+    // VK_EXT_descriptor_buffer: descriptors live in a host-visible buffer instead of `vkDPool`/`vkDSet`
+    BufferHandle descriptorBuffer;
+    VkDeviceAddress descriptorBufferAddress = 0;
+    VkDeviceSize descriptorBufferSize = 0;
+    VkDeviceSize bindingOffsets[5] = {}; // indexed by kBinding_Textures...kBinding_AccelerationStructures
   };
 
   lvk::Result createInstance();
@@ -742,8 +1155,35 @@ class VulkanContext final : public IContext {
   void querySurfaceCapabilities();
   void processDeferredTasks() const;
   void waitDeferredTasks();
+  // `commandBuffers` go to one queue in a single vkQueueSubmit2(); `present` and `release` apply to the last one
+  SubmitHandle submitCommandBuffers(const ldr::Span<ICommandBuffer*>& commandBuffers,
+                                    TextureHandle present,
+                                    const ldr::Span<TextureHandle>& release,
+                                    SubmitHandle* outHandles);
   void generateMipmap(TextureHandle handle) const;
+  // ContextConfig::pipelineCacheDirectory
+  std::vector<uint8_t> loadPipelineCacheFile();
+  // `async` hands the write to a pipeline compilation thread
+  void savePipelineCacheFile(bool async = false);
+  void writePipelineCacheFile() const;
+  // waits for the background compilation of `variant` (if any) and takes over its VkPipeline
+  // the optimized link of a fast-linked pipeline is skipped if not yet started (or left running when `waitForOptimizedLink` is false)
+  void finishPipelineCompilation(RenderPipelineState::Variant& variant, bool waitForOptimizedLink = true);
+  void finishPipelineCompilation(RenderPipelineState& rps); // all variants
+  void compileRenderPipeline(RenderPipelineCompileJob& job); // can run on pipeline compilation threads
+  // VK_EXT_graphics_pipeline_library: a cached library (or a new one) for one part of `job`
+  VkPipeline getPipelineLibrary(RenderPipelineCompileJob& job,
+                                VkGraphicsPipelineLibraryFlagsEXT part,
+                                uint64_t hash,
+                                const std::vector<uint8_t>& key);
+  lvk::Result createDescriptorSetLayout(uint32_t maxTextures, uint32_t maxSamplers, uint32_t maxAccelStructs);
   lvk::Result growDescriptorPool(VulkanContext::DescriptorSet& dset, uint32_t maxTextures, uint32_t maxSamplers, uint32_t maxAccelStructs);
+  lvk::Result createDescriptorBuffer(VulkanContext::DescriptorSet& dset, bool copyContents);
+  void writeDescriptors(const VulkanContext::DescriptorSet& dset, const VkWriteDescriptorSet* writes, uint32_t numWrites);
+  // identical SPIR-V, used to confirm pipelines with equal hashes
+  bool isSameShaderModule(ShaderModuleHandle a, ShaderModuleHandle b) const;
+  // acquired command buffers which are not submitted yet are not covered by `DescriptorSet::handle_`
+  bool isBoundByRecordingCommandBuffers(const VulkanContext::DescriptorSet& dset) const;
   ShaderModuleState createShaderModuleFromSPIRV(const void* spirv, size_t numBytes, const char* debugName, Result* outResult) const;
   ShaderModuleState createShaderModuleFromGLSL(ShaderStage stage,
                                                const char* source,
@@ -772,6 +1212,7 @@ class VulkanContext final : public IContext {
  private:
   friend class lvk::VulkanSwapchain;
   friend class lvk::VulkanStagingDevice;
+  friend class lvk::VulkanSecondaryCommands;
 
   VkInstance vkInstance_ = VK_NULL_HANDLE;
   VkDebugUtilsMessengerEXT vkDebugUtilsMessenger_ = VK_NULL_HANDLE;
@@ -799,6 +1240,11 @@ class VulkanContext final : public IContext {
   VkPhysicalDeviceFragmentDensityMapPropertiesEXT vkFragmentDensityMapProperties_ = {
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT};
   VkPhysicalDeviceMeshShaderPropertiesEXT vkMeshShaderProperties_ = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT};
+  VkPhysicalDeviceMultiDrawPropertiesEXT vkMultiDrawProperties_ = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT};
+  VkPhysicalDeviceDescriptorBufferPropertiesEXT vkDescriptorBufferProperties_ = {
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT};
+  VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT vkGraphicsPipelineLibraryProperties_ = {
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT};
   // queried (not chained by default) - only added to vkFeatures10_ when VK_EXT_mesh_shader is supported
   VkPhysicalDeviceMeshShaderFeaturesEXT vkMeshShaderFeatures_ = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT};
   // queried (not chained by default) - only added to vkFeatures10_ when VK_EXT_fragment_density_map is supported
@@ -807,6 +1253,12 @@ class VulkanContext final : public IContext {
   // queried (not chained by default) - only added to vkFeatures10_ when VK_KHR_fragment_shading_rate is supported
   VkPhysicalDeviceFragmentShadingRateFeaturesKHR vkFragmentShadingRateFeatures_ = {
       .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR};
+  // queried (not chained by default) - only added to vkFeatures10_ when VK_EXT_descriptor_buffer is requested and supported
+  VkPhysicalDeviceDescriptorBufferFeaturesEXT vkDescriptorBufferFeatures_ = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT};
+  // queried (not chained by default) - only added to vkFeatures10_ when VK_EXT_graphics_pipeline_library is requested and supported
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT vkGraphicsPipelineLibraryFeatures_ = {
+      .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT};
   // provided by Vulkan 1.4
   VkPhysicalDeviceVulkan14Properties vkPhysicalDeviceVulkan14Properties_ = {
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_PROPERTIES,
@@ -846,9 +1298,19 @@ class VulkanContext final : public IContext {
   VkSemaphore timelineSemaphore_ = VK_NULL_HANDLE;
   std::unique_ptr<lvk::VulkanImmediateCommands> immediate_;
   std::unique_ptr<lvk::VulkanImmediateCommands> immediateCompute_; // dedicated async-compute queue (optional)
+  std::unique_ptr<lvk::VulkanImmediateCommands> immediateTransfer_; // dedicated transfer queue for staging copies (optional)
   std::unique_ptr<lvk::VulkanStagingDevice> stagingDevice_;
+  std::unique_ptr<lvk::VulkanSecondaryCommands> secondaryCommands_; // per-thread command pools for secondary command buffers
   VkDescriptorSetLayout dslInputAttachments_ = VK_NULL_HANDLE;
-  std::vector<DescriptorSet> DSets_ = {};
+  // the bindless layout is shared by all descriptor sets, so switching between them does not rebuild pipelines
+  VkDescriptorSetLayout vkDSL_ = VK_NULL_HANDLE;
+  uint32_t dslMaxTextures_ = 0;
+  uint32_t dslMaxSamplers_ = 0;
+  uint32_t dslMaxAccelStructs_ = 0;
+  uint32_t dslNumYUVImages_ = 0;
+  std::vector<VkSampler> dslImmutableSamplers_; // Ycbcr samplers of `kBinding_YUVImages`, these live as long as the context
+  std::vector<DescriptorSet> DSets_ = {}; // a ring of up to ContextConfig::maxDescriptorSets, oldest after `lastUpdatedDSet_`
+  DescriptorSetStats descriptorSetStats_; // cumulative counters only, the rest is gathered in getDescriptorSetStats()
   size_t lastUpdatedDSet_ = 0;
   // don't use staging on devices with shared host-visible memory
   bool useStaging_ = true;
@@ -860,6 +1322,12 @@ class VulkanContext final : public IContext {
   // a texture/sampler was created since the last descriptor set update
   mutable bool awaitingCreation_ = false;
   mutable bool awaitingNewImmutableSamplers_ = false;
+  // bindless slots changed since the last descriptor set update - written in place when possible
+  std::vector<uint32_t> dirtyTextures_;
+  std::vector<uint32_t> dirtySamplers_;
+  bool dirtyAccelStructs_ = false;
+  // incremented whenever a descriptor set is (re)written; command lists recorded against an older one are stale
+  uint64_t descriptorSetsGeneration_ = 0;
 
   lvk::ContextConfig config_;
   // Adreno GPUs do not support unbounded arrays of acceleration structures (kTLAS[]) - use a fixed-size array declaration in shaders
@@ -879,6 +1347,9 @@ class VulkanContext final : public IContext {
   bool has_EXT_device_fault_ = false;
   bool has_EXT_shader_tile_image = false;
   bool has_EXT_mesh_shader_ = false;
+  bool has_EXT_multi_draw_ = false;
+  bool has_EXT_descriptor_buffer_ = false; // enabled only via ContextConfig::enableDescriptorBuffer
+  bool has_EXT_graphics_pipeline_library_ = false; // enabled only via ContextConfig::enableGraphicsPipelineLibrary
   bool has_MVK_macos_surface_ = false;
   bool has_KHR_shared_presentable_image_ = false;
   bool has_KHR_present_mode_fifo_latest_ready_ = false;
@@ -889,6 +1360,7 @@ class VulkanContext final : public IContext {
   bool has_EXT_host_image_copy_ = false; // promoted to Vulkan 1.4
   // VK_EXT_host_image_copy
   bool hostImageCopyToShaderReadOnly_ = false; // SHADER_READ_ONLY_OPTIMAL is a usable copy destination
+  bool hostImageCopyFromShaderReadOnly_ = false; // SHADER_READ_ONLY_OPTIMAL is a usable copy source
   bool hostImageCopyIdenticalMemoryTypeRequirements_ = false; // HOST_TRANSFER preserves memory type requirements
   uint32_t deviceLocalMemoryTypeMask_ = 0; // bitmask of device-local memory type indices
   std::vector<const char*> enabledInstanceExtensionNames_;
@@ -905,6 +1377,7 @@ class VulkanContext final : public IContext {
   ldr::Pool<lvk::Texture, lvk::VulkanImage> texturesPool_;
   ldr::Pool<lvk::QueryPool, VkQueryPool> queriesPool_;
   ldr::Pool<lvk::AccelerationStructure, lvk::AccelerationStructure> accelStructuresPool_;
+  ldr::Pool<lvk::CommandList, lvk::CommandListState> commandListsPool_;
 };
 
 } // namespace lvk
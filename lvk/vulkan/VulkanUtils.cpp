@@ -506,9 +506,12 @@ uint32_t lvk::findQueueFamilyIndex(VkPhysicalDevice physDev, VkQueueFlags flags)
       return q;
   }
 
-  // dedicated queue for transfer
+  // dedicated queue for transfer (prefer a transfer-only family, i.e. DMA engines)
   if (flags & VK_QUEUE_TRANSFER_BIT) {
-    const uint32_t q = findDedicatedQueueFamilyIndex(flags, VK_QUEUE_GRAPHICS_BIT);
+    uint32_t q = findDedicatedQueueFamilyIndex(flags, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+    if (q != DeviceQueues::INVALID)
+      return q;
+    q = findDedicatedQueueFamilyIndex(flags, VK_QUEUE_GRAPHICS_BIT);
     if (q != DeviceQueues::INVALID)
       return q;
   }
@@ -92,6 +92,10 @@ void createDemo(VulkanApp& app, const char* name, lvk::Format format, const char
   const int32_t texWidth = 1920;
   const int32_t texHeight = 1080;
 
+  lvk::IContext* ctx = app.ctx_.get();
+
+#if defined(ANDROID)
+  // the content is packed into a tarball on Android, so it cannot be streamed from a file
   std::vector<uint8_t> pixels = app.loadFile(filePath.c_str());
 
   LVK_ASSERT_MSG(!pixels.empty(), "Cannot load textures. Run `deploy_content.py`/`deploy_content_android.py` before running this app.");
@@ -101,18 +105,30 @@ void createDemo(VulkanApp& app, const char* name, lvk::Format format, const char
   }
 
   LVK_ASSERT(pixels.size() == (size_t)texWidth * texHeight * 3 / 2);
-
-  lvk::IContext* ctx = app.ctx_.get();
+#endif // ANDROID
 
   lvk::Holder<lvk::TextureHandle> texture = ctx->createTexture({
       .type = lvk::TextureType_2D,
       .format = format,
       .dimensions = {(uint32_t)texWidth, (uint32_t)texHeight},
       .usage = lvk::TextureUsageBits_Sampled,
+#if defined(ANDROID)
       .data = pixels.data(),
+#endif // ANDROID
       .debugName = name,
   });
 
+#if !defined(ANDROID)
+  // read the raw YUV pixels straight into staging memory
+  const lvk::Result result = ctx->uploadFromFile(texture, {.dimensions = {(uint32_t)texWidth, (uint32_t)texHeight}}, filePath.c_str());
+
+  LVK_ASSERT_MSG(result.isOk(), "Cannot load textures. Run `deploy_content.py`/`deploy_content_android.py` before running this app.");
+  if (!result.isOk()) {
+    printf("Cannot load textures. Run `deploy_content.py`/`deploy_content_android.py` before running this app.");
+    std::terminate();
+  }
+#endif // !ANDROID
+
   const uint32_t textureId = texture.index();
 
   res_.demos.push_back({
@@ -1815,6 +1815,8 @@ VULKAN_APP_MAIN {
         buf.cmdPushConstants(pc);
 
         // 1. Render opaque objects
+        // Not cmdDrawMulti(): every ROP selects its DrawData via its own baseInstance, while a multi-draw shares one baseInstance
+        // across all ranges (and gl_DrawID is not available when it falls back to separate draw calls)
         buf.cmdBindDepthState({.compareOp = lvk::CompareOp_Less, .isDepthWriteEnabled = true});
         for (const RenderOp& ROP : renderQueueOpaque) {
           buf.cmdBindRenderPipeline(g_Wireframe ? ROP.pipelineW : ROP.pipeline);
@@ -43,6 +43,7 @@
 #if defined(LVK_WITH_IMPLOT)
 #include <implot.h>
 #endif // LVK_WITH_IMPLOT
+#include <lvk/HelpersCulling.h>
 #include <lvk/HelpersImGui.h>
 #include <lvk/LVK.h>
 
@@ -68,7 +69,9 @@
 
 #include "DEMO_002_Bistro.cpp" // temporary
 
-constexpr uint32_t kMeshCacheVersion = 0xC0DE000A;
+constexpr uint32_t kMeshCacheVersion = 0xC0DE000B;
+constexpr uint32_t kNumTrianglesPerChunk = 4096; // the mesh is culled on the GPU in chunks of spatially sorted triangles
+constexpr float kModelScale = 0.05f;
 #if !defined(__APPLE__)
 constexpr int kNumSamplesMSAA = 8;
 #else
@@ -85,6 +88,8 @@ constexpr bool kEnableValidationLayers = false;
 #else
 constexpr bool kEnableValidationLayers = true;
 #endif // NDEBUG
+// loader threads decode textures straight into this staging memory (falling back to regular uploads when it is full)
+constexpr uint64_t kStagingReservationRingSize = 128ull * 1024ull * 1024ull;
 
 std::string folderThirdParty;
 std::string folderContentRoot;
@@ -463,6 +468,7 @@ lvk::Framebuffer fbOffscreen_;
 lvk::Holder<lvk::TextureHandle> fbOffscreenColor_;
 lvk::Holder<lvk::TextureHandle> fbOffscreenDepth_;
 lvk::Holder<lvk::TextureHandle> fbOffscreenResolve_;
+lvk::Holder<lvk::TextureHandle> fbOffscreenDepthResolve_; // single-sampled depth for the culling depth pyramid
 lvk::Framebuffer fbShadowMap_;
 lvk::Holder<lvk::ShaderModuleHandle> smMeshVert_;
 lvk::Holder<lvk::ShaderModuleHandle> smMeshFrag_;
@@ -485,6 +491,10 @@ lvk::Holder<lvk::RenderPipelineHandle> renderPipelineState_Fullscreen_;
 lvk::Holder<lvk::BufferHandle> vb0_, ib0_; // buffers for vertices and indices
 lvk::Holder<lvk::BufferHandle> sbMaterials_; // storage buffer for materials
 lvk::Holder<lvk::BufferHandle> ubPerFrame_, ubPerFrameShadow_, ubPerObject_;
+lvk::Holder<lvk::BufferHandle> sbChunkBounds_, sbChunkCommands_; // per-chunk bounding spheres and indirect draw commands
+lvk::Holder<lvk::BufferHandle> bufChunkCommandsVisible_, bufChunkCount_; // written by GPUCulling every frame
+uint32_t numChunks_ = 0;
+std::unique_ptr<lvk::GPUCulling> culling_;
 lvk::Holder<lvk::SamplerHandle> sampler_;
 lvk::Holder<lvk::SamplerHandle> samplerShadow_;
 lvk::Holder<lvk::TextureHandle> textureDummyWhite_;
@@ -492,6 +502,8 @@ lvk::Holder<lvk::TextureHandle> skyboxTextureReference_;
 lvk::Holder<lvk::TextureHandle> skyboxTextureIrradiance_;
 lvk::RenderPass renderPassOffscreen_;
 lvk::RenderPass renderPassMain_;
+lvk::Holder<lvk::CommandListHandle> commandListScene_; // re-created when the draw toggles change
+lvk::Holder<lvk::CommandListHandle> commandListShadow_;
 lvk::RenderPass renderPassShadow_;
 lvk::DepthState depthState_;
 lvk::DepthState depthStateLEqual_;
@@ -505,6 +517,7 @@ bool enableComputePass_ = false;
 bool enableWireframe_ = false;
 bool showPerfStats_ = false;
 bool drawNormals_ = false;
+bool enableOcclusionCulling_ = true;
 
 bool isShadowMapDirty_ = true;
 
@@ -589,9 +602,11 @@ struct LoadedImage {
   uint32_t w = 0;
   uint32_t h = 0;
   uint32_t channels = 0;
-  uint8_t* pixels = nullptr;
+  uint8_t* pixels = nullptr; // not decoded when a compressed KTX file exists (`w` and `h` tell whether the image is valid)
   std::string debugName;
   std::string compressedFileName;
+  lvk::StagingReservation staging; // filled by a loader thread, never cached
+  uint32_t stagingNumMipLevels = 1;
 };
 
 struct LoadedMaterial {
@@ -695,8 +710,11 @@ bool init(lvk::LVKwindow* window) {
                           .depth = {
                               .loadOp = lvk::LoadOp_Clear,
                               .storeOp = lvk::StoreOp_Store,
+                              // the farthest sample keeps the depth pyramid conservative
+                              .resolveMode = lvk::ResolveMode_Max,
                               .clearDepth = 1.0f,
-                          }};
+                          },
+                          .useSecondaryCommandBuffers = true};
 
   renderPassMain_ = {
       .color = {{.loadOp = lvk::LoadOp_Clear, .storeOp = lvk::StoreOp_Store, .clearColor = {0.0f, 0.0f, 0.0f, 1.0f}}},
@@ -704,6 +722,7 @@ bool init(lvk::LVKwindow* window) {
   renderPassShadow_ = {
       .color = {},
       .depth = {.loadOp = lvk::LoadOp_Clear, .storeOp = lvk::StoreOp_Store, .clearDepth = 1.0f},
+      .useSecondaryCommandBuffers = true,
   };
 
   fbMain_ = {
@@ -738,6 +757,11 @@ void destroy() {
   ubPerFrame_ = nullptr;
   ubPerFrameShadow_ = nullptr;
   ubPerObject_ = nullptr;
+  sbChunkBounds_ = nullptr;
+  sbChunkCommands_ = nullptr;
+  bufChunkCommandsVisible_ = nullptr;
+  bufChunkCount_ = nullptr;
+  culling_ = nullptr;
   smMeshVert_ = nullptr;
   smMeshFrag_ = nullptr;
   smMeshWireframeVert_ = nullptr;
@@ -749,6 +773,8 @@ void destroy() {
   smSkyboxVert_ = nullptr;
   smSkyboxFrag_ = nullptr;
   smGrayscaleComp_ = nullptr;
+  commandListScene_ = nullptr;
+  commandListShadow_ = nullptr;
   renderPipelineState_Mesh_ = nullptr;
   renderPipelineState_MeshNormals_ = nullptr;
   renderPipelineState_MeshWireframe_ = nullptr;
@@ -768,6 +794,7 @@ void destroy() {
   fbOffscreenColor_ = nullptr;
   fbOffscreenDepth_ = nullptr;
   fbOffscreenResolve_ = nullptr;
+  fbOffscreenDepthResolve_ = nullptr;
   queryPoolTimestamps_ = nullptr;
   ctx_ = nullptr;
 
@@ -845,10 +872,17 @@ bool loadAndCache(const char* cacheFileName) {
     meshopt_remapIndexBuffer(indexData_.data(), nullptr, indexCount, &remap[0]);
     meshopt_remapVertexBuffer(remappedVertices.data(), vertexData_.data(), indexCount, sizeof(VertexData), remap.data());
     vertexData_ = remappedVertices;
-    // 3. Optimize for the GPU vertex cache reuse and overdraw
-    meshopt_optimizeVertexCache(indexData_.data(), indexData_.data(), indexCount, remappedVertexCount);
-    meshopt_optimizeOverdraw(
-        indexData_.data(), indexData_.data(), indexCount, &vertexData_[0].position.x, remappedVertexCount, sizeof(VertexData), 1.05f);
+    // 3. Sort triangles spatially, so that every chunk of kNumTrianglesPerChunk triangles is compact enough to be culled
+    meshopt_spatialSortTriangles(
+        remap.data(), indexData_.data(), indexCount, &vertexData_[0].position.x, remappedVertexCount, sizeof(VertexData));
+    indexData_.assign(remap.begin(), remap.end());
+    // 4. Optimize every chunk for the GPU vertex cache reuse and overdraw
+    for (size_t first = 0; first < indexCount; first += 3 * kNumTrianglesPerChunk) {
+      uint32_t* chunk = indexData_.data() + first;
+      const size_t count = std::min(indexCount - first, size_t(3 * kNumTrianglesPerChunk));
+      meshopt_optimizeVertexCache(chunk, chunk, count, remappedVertexCount);
+      meshopt_optimizeOverdraw(chunk, chunk, count, &vertexData_[0].position.x, remappedVertexCount, sizeof(VertexData), 1.05f);
+    }
     meshopt_optimizeVertexFetch(
         vertexData_.data(), indexData_.data(), indexCount, vertexData_.data(), remappedVertexCount, sizeof(VertexData));
   }
@@ -964,6 +998,66 @@ bool initModel() {
                              .data = indexData_.data(),
                              .debugName = "Buffer: index"},
                             nullptr);
+
+  // one indirect draw per chunk of triangles; GPUCulling compacts the visible ones every frame
+  struct DrawIndexedIndirectCommand {
+    uint32_t indexCount;
+    uint32_t instanceCount;
+    uint32_t firstIndex;
+    int32_t vertexOffset;
+    uint32_t baseInstance;
+  };
+  static_assert(sizeof(DrawIndexedIndirectCommand) == 20);
+
+  std::vector<lvk::CullingBounds> bounds;
+  std::vector<DrawIndexedIndirectCommand> commands;
+
+  const uint32_t numIndices = (uint32_t)indexData_.size();
+
+  for (uint32_t first = 0; first < numIndices; first += 3 * kNumTrianglesPerChunk) {
+    const uint32_t count = std::min(numIndices - first, 3 * kNumTrianglesPerChunk);
+    vec3 minP = vertexData_[indexData_[first]].position;
+    vec3 maxP = minP;
+    for (uint32_t i = first; i != first + count; i++) {
+      minP = glm::min(minP, vertexData_[indexData_[i]].position);
+      maxP = glm::max(maxP, vertexData_[indexData_[i]].position);
+    }
+    // the model matrix is a uniform scale, so the world-space sphere is the scaled object-space one
+    const vec3 center = kModelScale * 0.5f * (minP + maxP);
+    bounds.push_back({
+        .center = {center.x, center.y, center.z},
+        .radius = kModelScale * 0.5f * glm::length(maxP - minP),
+    });
+    commands.push_back({.indexCount = count, .instanceCount = 1, .firstIndex = first});
+  }
+
+  numChunks_ = (uint32_t)commands.size();
+
+  sbChunkBounds_ = ctx_->createBuffer({.usage = lvk::BufferUsageBits_Storage,
+                                       .storage = lvk::StorageType_Device,
+                                       .size = sizeof(lvk::CullingBounds) * bounds.size(),
+                                       .data = bounds.data(),
+                                       .debugName = "Buffer: chunk bounds"},
+                                      nullptr);
+  sbChunkCommands_ = ctx_->createBuffer({.usage = lvk::BufferUsageBits_Storage,
+                                         .storage = lvk::StorageType_Device,
+                                         .size = sizeof(DrawIndexedIndirectCommand) * commands.size(),
+                                         .data = commands.data(),
+                                         .debugName = "Buffer: chunk commands"},
+                                        nullptr);
+  bufChunkCommandsVisible_ = ctx_->createBuffer({.usage = lvk::BufferUsageBits_Indirect | lvk::BufferUsageBits_Storage,
+                                                 .storage = lvk::StorageType_Device,
+                                                 .size = sizeof(DrawIndexedIndirectCommand) * commands.size(),
+                                                 .debugName = "Buffer: visible chunk commands"},
+                                                nullptr);
+  bufChunkCount_ = ctx_->createBuffer({.usage = lvk::BufferUsageBits_Indirect | lvk::BufferUsageBits_Storage,
+                                       .storage = lvk::StorageType_Device,
+                                       .size = sizeof(uint32_t),
+                                       .debugName = "Buffer: visible chunk count"},
+                                      nullptr);
+
+  culling_ = std::make_unique<lvk::GPUCulling>(*ctx_);
+
   return true;
 }
 
@@ -1158,6 +1252,12 @@ void createOffscreenFramebuffer() {
                                                .usage = usage,
                                                .debugName = "Offscreen framebuffer (color resolve)"});
     fb.color[0].resolveTexture = fbOffscreenResolve_;
+    fbOffscreenDepthResolve_ = ctx_->createTexture({.type = lvk::TextureType_2D,
+                                                    .format = descDepth.format,
+                                                    .dimensions = {w, h},
+                                                    .usage = lvk::TextureUsageBits_Attachment | lvk::TextureUsageBits_Sampled,
+                                                    .debugName = "Offscreen framebuffer (depth resolve)"});
+    fb.depthStencil.resolveTexture = fbOffscreenDepthResolve_;
   }
 
   fbOffscreen_ = fb;
@@ -1175,6 +1275,68 @@ void showTimeGPU();
 double getCurrentTimestamp();
 void processLoadedMaterials(lvk::ICommandBuffer& buffer);
 
+lvk::Holder<lvk::CommandListHandle> createSceneCommandList() {
+  // the scene pass does not change from frame to frame: record it once (LVK re-records it when the pipelines or textures change)
+  return ctx_->createCommandList(
+      [drawNormals = drawNormals_, enableWireframe = enableWireframe_](lvk::ICommandBuffer& buffer) {
+        // Scene
+        buffer.cmdBindRenderPipeline(drawNormals ? renderPipelineState_MeshNormals_ : renderPipelineState_Mesh_);
+        buffer.cmdPushDebugGroupLabel("Render Mesh", 0xff0000ff);
+        buffer.cmdBindDepthState(depthState_);
+        buffer.cmdBindVertexBuffer(0, vb0_, 0);
+
+        struct {
+          uint64_t perFrame;
+          uint64_t perObject;
+          uint64_t materials;
+        } bindings = {
+            .perFrame = ctx_->gpuAddress(ubPerFrame_),
+            .perObject = ctx_->gpuAddress(ubPerObject_),
+            .materials = ctx_->gpuAddress(sbMaterials_),
+        };
+        buffer.cmdPushConstants(bindings);
+        buffer.cmdBindIndexBuffer(ib0_, lvk::IndexFormat_UI32);
+        // only the chunks which passed GPU culling in this frame
+        buffer.cmdDrawIndexedIndirectCount(bufChunkCommandsVisible_, 0, bufChunkCount_, 0, numChunks_);
+        if (enableWireframe) {
+          buffer.cmdBindRenderPipeline(renderPipelineState_MeshWireframe_);
+          buffer.cmdDrawIndexedIndirectCount(bufChunkCommandsVisible_, 0, bufChunkCount_, 0, numChunks_);
+        }
+        buffer.cmdPopDebugGroupLabel();
+
+        // Skybox
+        buffer.cmdBindRenderPipeline(renderPipelineState_Skybox_);
+        buffer.cmdPushDebugGroupLabel("Render Skybox", 0x00ff00ff);
+        buffer.cmdBindDepthState(depthStateLEqual_);
+        buffer.cmdDraw(3 * 6 * 2);
+        buffer.cmdPopDebugGroupLabel();
+      },
+      "Command list: scene");
+}
+
+lvk::Holder<lvk::CommandListHandle> createShadowCommandList() {
+  // the shadow map is re-rendered only when it is dirty, but the pass itself never changes
+  return ctx_->createCommandList(
+      [](lvk::ICommandBuffer& buffer) {
+        buffer.cmdBindRenderPipeline(renderPipelineState_Shadow_);
+        buffer.cmdPushDebugGroupLabel("Render Shadows", 0xff0000ff);
+        buffer.cmdBindDepthState(depthState_);
+        buffer.cmdBindVertexBuffer(0, vb0_, 0);
+        struct {
+          uint64_t perFrame;
+          uint64_t perObject;
+        } bindings = {
+            .perFrame = ctx_->gpuAddress(ubPerFrameShadow_),
+            .perObject = ctx_->gpuAddress(ubPerObject_),
+        };
+        buffer.cmdPushConstants(bindings);
+        buffer.cmdBindIndexBuffer(ib0_, lvk::IndexFormat_UI32);
+        buffer.cmdDrawIndexed(static_cast<uint32_t>(indexData_.size()));
+        buffer.cmdPopDebugGroupLabel();
+      },
+      "Command list: shadow");
+}
+
 void render(double delta) {
   LVK_PROFILER_FUNCTION();
 
@@ -1196,6 +1358,7 @@ void render(double delta) {
     ImGui::Text("C - toggle compute shader postprocessing");
     ImGui::Text("N - toggle normals");
     ImGui::Text("T - toggle wireframe");
+    ImGui::Text("O - toggle occlusion culling");
     ImGui::Text("P - show perf stats");
     ImGui::End();
 
@@ -1263,13 +1426,20 @@ void render(double delta) {
       .samplerShadow = samplerShadow_.index(),
   };
 
-  const mat4 modelMatrix = glm::scale(mat4(1.0f), vec3(0.05f));
+  const mat4 modelMatrix = glm::scale(mat4(1.0f), vec3(kModelScale));
 
   const UniformsPerObject perObject = {
       .model = modelMatrix,
       .normal = glm::transpose(glm::inverse(modelMatrix)),
   };
 
+  if (commandListScene_.empty()) {
+    commandListScene_ = createSceneCommandList();
+  }
+  if (commandListShadow_.empty()) {
+    commandListShadow_ = createShadowCommandList();
+  }
+
   lvk::ICommandBuffer& buffer = ctx_->acquireCommandBuffer();
 
   processLoadedMaterials(buffer);
@@ -1285,23 +1455,7 @@ void render(double delta) {
     };
     buffer.cmdUpdateBuffer(ubPerFrameShadow_, 0, sizeof(perFrameShadow), &perFrameShadow);
     buffer.cmdBeginRendering(renderPassShadow_, fbShadowMap_);
-    {
-      buffer.cmdBindRenderPipeline(renderPipelineState_Shadow_);
-      buffer.cmdPushDebugGroupLabel("Render Shadows", 0xff0000ff);
-      buffer.cmdBindDepthState(depthState_);
-      buffer.cmdBindVertexBuffer(0, vb0_, 0);
-      struct {
-        uint64_t perFrame;
-        uint64_t perObject;
-      } bindings = {
-          .perFrame = ctx_->gpuAddress(ubPerFrameShadow_),
-          .perObject = ctx_->gpuAddress(ubPerObject_),
-      };
-      buffer.cmdPushConstants(bindings);
-      buffer.cmdBindIndexBuffer(ib0_, lvk::IndexFormat_UI32);
-      buffer.cmdDrawIndexed(static_cast<uint32_t>(indexData_.size()));
-      buffer.cmdPopDebugGroupLabel();
-    }
+    buffer.cmdExecuteCommandList(commandListShadow_);
     buffer.cmdEndRendering();
     buffer.cmdTransitionToShaderReadOnly({fbShadowMap_.depthStencil.texture}, {});
     buffer.cmdGenerateMipmap(fbShadowMap_.depthStencil.texture);
@@ -1316,41 +1470,29 @@ void render(double delta) {
 
     GPU_TIMESTAMP(GPUTimestamp_BeginSceneRendering);
 
-    // This will clear the framebuffer
-    buffer.cmdBeginRendering(renderPassOffscreen_, fbOffscreen_);
-    {
-      // Scene
-      buffer.cmdBindRenderPipeline(drawNormals_ ? renderPipelineState_MeshNormals_ : renderPipelineState_Mesh_);
-      buffer.cmdPushDebugGroupLabel("Render Mesh", 0xff0000ff);
-      buffer.cmdBindDepthState(depthState_);
-      buffer.cmdBindVertexBuffer(0, vb0_, 0);
+    // the same matrix as for rendering, so that culling clips exactly like the rasterizer and compares the same depth values;
+    // occlusion is tested against the depth pyramid of the previous frame
+    const mat4 viewProjCulling = perFrame_.proj * perFrame_.view;
+    culling_->cmdCull(buffer,
+                      {
+                          .viewProj = glm::value_ptr(viewProjCulling),
+                          .bounds = sbChunkBounds_,
+                          .drawCommands = sbChunkCommands_,
+                          .drawCommandsOut = bufChunkCommandsVisible_,
+                          .drawCount = bufChunkCount_,
+                          .numObjects = numChunks_,
+                          .occlusion = enableOcclusionCulling_,
+                      });
 
-      struct {
-        uint64_t perFrame;
-        uint64_t perObject;
-        uint64_t materials;
-      } bindings = {
-          .perFrame = ctx_->gpuAddress(ubPerFrame_),
-          .perObject = ctx_->gpuAddress(ubPerObject_),
-          .materials = ctx_->gpuAddress(sbMaterials_),
-      };
-      buffer.cmdPushConstants(bindings);
-      buffer.cmdBindIndexBuffer(ib0_, lvk::IndexFormat_UI32);
-      buffer.cmdDrawIndexed(static_cast<uint32_t>(indexData_.size()));
-      if (enableWireframe_) {
-        buffer.cmdBindRenderPipeline(renderPipelineState_MeshWireframe_);
-        buffer.cmdDrawIndexed(static_cast<uint32_t>(indexData_.size()));
-      }
-      buffer.cmdPopDebugGroupLabel();
+    // This will clear the framebuffer
+    buffer.cmdBeginRendering(renderPassOffscreen_, fbOffscreen_, {.buffers = {bufChunkCommandsVisible_, bufChunkCount_}});
+    buffer.cmdExecuteCommandList(commandListScene_);
+    buffer.cmdEndRendering();
 
-      // Skybox
-      buffer.cmdBindRenderPipeline(renderPipelineState_Skybox_);
-      buffer.cmdPushDebugGroupLabel("Render Skybox", 0x00ff00ff);
-      buffer.cmdBindDepthState(depthStateLEqual_);
-      buffer.cmdDraw(3 * 6 * 2);
-      buffer.cmdPopDebugGroupLabel();
+    if (enableOcclusionCulling_) {
+      const lvk::TextureHandle depth = kNumSamplesMSAA > 1 ? fbOffscreen_.depthStencil.resolveTexture : fbOffscreen_.depthStencil.texture;
+      culling_->cmdBuildDepthPyramid(buffer, depth);
     }
-    buffer.cmdEndRendering();
 
     GPU_TIMESTAMP(GPUTimestamp_EndSceneRendering);
   }
@@ -1550,16 +1692,28 @@ LoadedImage loadImage(const char* fileName, int channels) {
     }
   }
 
-  int w, h;
-  uint8_t* pixels = stbi_load(fileName, &w, &h, nullptr, channels);
+  const std::string compressedFileName = convertFileName(fileName);
+
+  // KTX mip chains are read straight into staging memory by stageImage(), so only the dimensions are needed here
+  const bool hasCompressedTexture = kEnableCompression && channels == 4 && std::filesystem::exists(compressedFileName.c_str());
+
+  int w = 0, h = 0;
+  uint8_t* pixels = nullptr;
+  if (hasCompressedTexture) {
+    if (!stbi_info(fileName, &w, &h, nullptr)) {
+      w = h = 0;
+    }
+  } else {
+    pixels = stbi_load(fileName, &w, &h, nullptr, channels);
+  }
 
   const LoadedImage img = {
-      .w = (uint32_t)w,
-      .h = (uint32_t)h,
+      .w = pixels || hasCompressedTexture ? (uint32_t)w : 0u,
+      .h = pixels || hasCompressedTexture ? (uint32_t)h : 0u,
       .channels = (uint32_t)channels,
       .pixels = pixels,
       .debugName = debugName,
-      .compressedFileName = convertFileName(fileName),
+      .compressedFileName = compressedFileName,
   };
 
   if (img.pixels && kEnableCompression && (channels != 1) && !std::filesystem::exists(img.compressedFileName.c_str())) {
@@ -1573,6 +1727,49 @@ LoadedImage loadImage(const char* fileName, int channels) {
   return img;
 }
 
+// runs on the loader threads: the image goes straight into mapped staging memory, so the main thread only records the GPU copy
+LoadedImage stageImage(LoadedImage img) {
+  LVK_PROFILER_FUNCTION();
+
+  if (!img.w) {
+    return img;
+  }
+
+  const bool hasCompressedTexture = kEnableCompression && img.channels == 4 && std::filesystem::exists(img.compressedFileName.c_str());
+
+  if (hasCompressedTexture) {
+    // read the mip-levels from the file directly into the reservation (no intermediate KTX storage)
+    ktxTexture* texture = nullptr;
+    if (ktxTexture_CreateFromNamedFile(img.compressedFileName.c_str(), KTX_TEXTURE_CREATE_NO_FLAGS, &texture) != KTX_SUCCESS) {
+      return img;
+    }
+    SCOPE_EXIT {
+      ktxTexture_Destroy(ktxTexture(texture));
+    };
+    const ktx_size_t size = ktxTexture_GetDataSize(texture);
+    img.staging = ctx_->reserveStaging(size);
+    if (img.staging.empty()) {
+      return img;
+    }
+    if (!LVK_VERIFY(ktxTexture_LoadImageData(texture, static_cast<ktx_uint8_t*>(img.staging.data), size) == KTX_SUCCESS)) {
+      ctx_->cancelStaging(img.staging);
+      img.staging = {};
+      return img;
+    }
+    img.stagingNumMipLevels = lvk::calcNumMipLevels(img.w, img.h);
+  } else {
+    // stb_image always decodes into its own allocation, so uncompressed images take one copy here on the loader thread
+    const size_t size = (size_t)img.w * img.h * img.channels;
+    img.staging = ctx_->reserveStaging(size);
+    if (img.staging.empty()) {
+      return img;
+    }
+    memcpy(img.staging.data, img.pixels, size);
+  }
+
+  return img;
+}
+
 void loadMaterial(size_t i) {
   LVK_PROFILER_FUNCTION();
 
@@ -1595,12 +1792,11 @@ void loadMaterial(size_t i) {
 
 #undef LOAD_TEX
 
-  const LoadedMaterial mtl{i, ambient, diffuse, alpha};
-
-  if (!mtl.ambient.pixels && !mtl.diffuse.pixels) {
+  if (!ambient.w && !diffuse.w) {
     // skip missing textures
     materials_[i].texDiffuse = 0;
   } else {
+    const LoadedMaterial mtl{i, stageImage(ambient), stageImage(diffuse), stageImage(alpha)};
     std::lock_guard guard(loadedMaterialsMutex_);
     loadedMaterials_.push_back(mtl);
     remainingMaterialsToLoad_.fetch_add(1u, std::memory_order_release);
@@ -1823,24 +2019,30 @@ lvk::Format formatFromChannels(uint32_t channels) {
 }
 
 lvk::TextureHandle createTexture(const LoadedImage& img) {
-  if (!img.pixels) {
+  if (!img.w) {
     return {};
   }
 
   const auto it = texturesCache_.find(img.debugName);
 
   if (it != texturesCache_.end()) {
+    // another material has already uploaded the same image
+    if (!img.staging.empty()) {
+      ctx_->cancelStaging(img.staging);
+    }
     return it->second;
   }
 
   const bool hasCompressedTexture = kEnableCompression && img.channels == 4 && std::filesystem::exists(img.compressedFileName.c_str());
+  // a loader thread has already put the image into staging memory
+  const bool isStaged = !img.staging.empty();
 
-  const void* initialData = img.pixels;
-  uint32_t initialDataNumMipLevels = 1u;
+  const void* initialData = isStaged ? nullptr : img.pixels;
+  uint32_t initialDataNumMipLevels = isStaged ? img.stagingNumMipLevels : 1u;
 
   ktxTexture* texture = nullptr;
 
-  if (hasCompressedTexture) {
+  if (hasCompressedTexture && !isStaged) {
     // uploading the texture
     if (!LVK_VERIFY(ktxTexture_CreateFromNamedFile(img.compressedFileName.c_str(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &texture) ==
                     KTX_SUCCESS)) {
@@ -1871,6 +2073,7 @@ lvk::TextureHandle createTexture(const LoadedImage& img) {
       .components = (img.channels == 1) ? lvk::ComponentMapping{lvk::Swizzle_R, lvk::Swizzle_R, lvk::Swizzle_R, lvk::Swizzle_R}
                                         : lvk::ComponentMapping{},
       .data = initialData,
+      .dataStaging = img.staging,
       .dataNumMipLevels = initialDataNumMipLevels,
       .generateMipmaps = generateMipmaps,
       .debugName = img.debugName.c_str(),
@@ -1900,9 +2103,12 @@ void processLoadedMaterials(lvk::ICommandBuffer& buffer) {
   {
     MaterialTextures tex;
 
+    // upload all textures of this material (including mip-maps) with a single submit
+    ctx_->beginUploadBatch();
     tex.ambient = createTexture(mtl.ambient);
     tex.diffuse = createTexture(mtl.diffuse);
     tex.alpha = createTexture(mtl.alpha);
+    ctx_->endUploadBatch();
 
     // update GPU materials
     materials_[mtl.idx].texAmbient = tex.ambient.index();
@@ -2083,6 +2289,7 @@ int main(int argc, char* argv[]) {
                                                height_,
                                                {
                                                    .enableValidation = kEnableValidationLayers,
+                                                   .stagingReservationRingSize = kStagingReservationRingSize,
                                                },
                                                kPreferIntegratedGPU ? lvk::HWDeviceType_Integrated : lvk::HWDeviceType_Discrete);
   if (!ctx_) {
@@ -2137,16 +2344,21 @@ int main(int argc, char* argv[]) {
     }
     if (key == GLFW_KEY_N && pressed) {
       drawNormals_ = !drawNormals_;
+      commandListScene_ = nullptr;
     }
     if (key == GLFW_KEY_C && pressed) {
       enableComputePass_ = !enableComputePass_;
     }
     if (key == GLFW_KEY_T && pressed) {
       enableWireframe_ = !enableWireframe_;
+      commandListScene_ = nullptr;
     }
     if (key == GLFW_KEY_P && pressed) {
       showPerfStats_ = !showPerfStats_;
     }
+    if (key == GLFW_KEY_O && pressed) {
+      enableOcclusionCulling_ = !enableOcclusionCulling_;
+    }
     if (key == GLFW_KEY_ESCAPE && pressed)
       glfwSetWindowShouldClose(window, GLFW_TRUE);
     if (key == GLFW_KEY_W) {
@@ -2268,16 +2480,21 @@ int main(int argc, char* argv[]) {
         }
         if (key == SDLK_N && pressed) {
           drawNormals_ = !drawNormals_;
+          commandListScene_ = nullptr;
         }
         if (key == SDLK_C && pressed) {
           enableComputePass_ = !enableComputePass_;
         }
         if (key == SDLK_T && pressed) {
           enableWireframe_ = !enableWireframe_;
+          commandListScene_ = nullptr;
         }
         if (key == SDLK_P && pressed) {
           showPerfStats_ = !showPerfStats_;
         }
+        if (key == SDLK_O && pressed) {
+          enableOcclusionCulling_ = !enableOcclusionCulling_;
+        }
         if (key == SDLK_W) {
           positioner_.movement_.forward_ = pressed;
         }
@@ -2364,6 +2581,7 @@ void handle_cmd(android_app* app, int32_t cmd) {
                                                    height_,
                                                    {
                                                        .enableValidation = kEnableValidationLayers,
+                                                       .stagingReservationRingSize = kStagingReservationRingSize,
                                                    },
                                                    kPreferIntegratedGPU ? lvk::HWDeviceType_Integrated : lvk::HWDeviceType_Discrete);
       if (!init(nullptr)) {